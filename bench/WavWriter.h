@@ -0,0 +1,80 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+namespace zlkm::bench {
+
+// Minimal PCM WAV writer for interleaved integer samples. The header is
+// written on open() with zero sizes and patched on close().
+class WavWriter {
+ public:
+  WavWriter() = default;
+  WavWriter(const WavWriter&) = delete;
+  WavWriter& operator=(const WavWriter&) = delete;
+  ~WavWriter() { close(); }
+
+  // bytesPerSample is the container width; 3 for packed 24-bit
+  bool open(const char* path, int sampleRate, int channels,
+            int bytesPerSample) {
+    close();
+    f_ = fopen(path, "wb");
+    if (!f_) return false;
+    sampleRate_ = sampleRate;
+    channels_ = channels;
+    bytesPerSample_ = bytesPerSample;
+    dataBytes_ = 0;
+    writeHeader_();
+    return true;
+  }
+
+  void write(const void* data, size_t bytes) {
+    if (!f_) return;
+    dataBytes_ += (uint32_t)fwrite(data, 1, bytes, f_);
+  }
+
+  void close() {
+    if (!f_) return;
+    fseek(f_, 0, SEEK_SET);
+    writeHeader_();
+    fclose(f_);
+    f_ = nullptr;
+  }
+
+  bool isOpen() const { return f_ != nullptr; }
+
+ private:
+  void put16_(uint16_t v) {
+    const uint8_t b[2] = {uint8_t(v), uint8_t(v >> 8)};
+    fwrite(b, 1, 2, f_);
+  }
+  void put32_(uint32_t v) {
+    const uint8_t b[4] = {uint8_t(v), uint8_t(v >> 8), uint8_t(v >> 16),
+                          uint8_t(v >> 24)};
+    fwrite(b, 1, 4, f_);
+  }
+
+  void writeHeader_() {
+    const uint16_t blockAlign = uint16_t(channels_ * bytesPerSample_);
+    fwrite("RIFF", 1, 4, f_);
+    put32_(36u + dataBytes_);
+    fwrite("WAVEfmt ", 1, 8, f_);
+    put32_(16);  // PCM fmt chunk size
+    put16_(1);   // PCM
+    put16_(uint16_t(channels_));
+    put32_(uint32_t(sampleRate_));
+    put32_(uint32_t(sampleRate_) * blockAlign);
+    put16_(blockAlign);
+    put16_(uint16_t(bytesPerSample_ * 8));
+    fwrite("data", 1, 4, f_);
+    put32_(dataBytes_);
+  }
+
+  FILE* f_ = nullptr;
+  int sampleRate_ = 0;
+  int channels_ = 0;
+  int bytesPerSample_ = 0;
+  uint32_t dataBytes_ = 0;
+};
+
+}  // namespace zlkm::bench
@@ -0,0 +1,194 @@
+// Offline render benchmark for CalcisHumilis<TR>::fillBlock.
+//
+// Drives fillBlock with a scripted sequence of triggers and Cfg changes,
+// writes each configuration's output to a WAV file and reports ns/frame,
+// blocks/s and worst-case block time against the real-time budget.
+//
+//   pio run -e native-bench -t exec
+//   ./.pio/build/native-bench/program [seconds] [outDir]
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+
+#include "CalcisHumilis.h"
+#include "WavWriter.h"
+#include "audio/AudioTraits.h"
+#include "audio/DJFilter.h"
+#include "audio/Event.h"
+
+namespace zlkm::bench {
+
+using audio::AudioTraits;
+
+// Timed hits: each step fires a trigger event on the exact frame at atSec;
+// its Cfg edits apply at the start of the block containing that frame
+template <class TR>
+struct Script {
+  using App = ch::CalcisHumilis<TR>;
+  using Cfg = typename App::Cfg;
+  using FilterParams = audio::SafeFilterParams<App::INTERNAL_SR>;
+
+  struct Step {
+    float atSec;
+    void (*apply)(Cfg&);
+  };
+
+  static constexpr std::array<Step, 10> kSteps = {{
+      {0.00f, [](Cfg&) {}},
+      {0.50f,
+       [](Cfg& c) {
+         c.hot.swarmOsc.voices = 3;
+         c.hot.swarmOsc.morph = 0.6f;
+       }},
+      {1.00f,
+       [](Cfg& c) {
+         FilterParams fp(&c.hot.filter, 0.25f, 0.9f, 0.5f, 0.f);
+       }},
+      {1.50f,
+       [](Cfg& c) {
+         c.hot.swarmOsc.voices = App::MAX_SWARM_VOICES;
+         c.hot.cyclesPerSample = App::cycles(110.f);
+       }},
+      {2.00f,
+       [](Cfg& c) {
+         c.hot.swarmOsc.randomPhase = false;
+         c.hot.swarmOsc.morph = 0.95f;
+         FilterParams fp(&c.hot.filter, 0.8f, 0.2f, 1.f, 0.3f);
+       }},
+      {2.50f,
+       [](Cfg& c) {
+         c.hot.swarmOsc.voices = 7;
+         c.hot.cyclesPerSample = App::cycles(45.f);
+         c.hot.outGain = 1.f;
+       }},
+      {2.75f, [](Cfg&) {}},
+      {3.00f,
+       [](Cfg& c) {
+         c.hot.swarmOsc.morphMode = 1;
+       }},
+      {3.25f,
+       [](Cfg& c) {
+         // Full route table spread over every destination
+         for (int r = 0; r < App::kMaxRoutes; ++r) {
+           const int dst = r % App::DestCount;
+           const float depth = dst == App::DestCutoff  ? 1.5f
+                               : dst == App::DestPitch ? 2.f
+                                                       : .1f;
+           c.cold.routes[r] = {uint8_t(r % App::EnvCount), uint8_t(dst),
+                               uint8_t(r & 1), 1, depth};
+         }
+       }},
+      {3.50f,
+       [](Cfg& c) {
+         c.cold.oscMode = App::OscFM;
+         c.hot.fm.algorithm = 2;
+       }},
+  }};
+};
+
+struct Stats {
+  uint64_t totalNs = 0;
+  uint64_t worstNs = 0;
+  uint64_t blocks = 0;
+  uint64_t frames = 0;
+};
+
+template <class TR>
+Stats render(float seconds, const char* outDir) {
+  using App = ch::CalcisHumilis<TR>;
+  using Steps = Script<TR>;
+  using Clock = std::chrono::steady_clock;
+
+  typename App::Cfg cfg{};
+  typename App::Feedback fb{};
+  App app(&cfg, &fb);
+  alignas(8) typename TR::BufferT buf{};
+
+  char path[256];
+  snprintf(path, sizeof(path), "%s/render_%d_os%d_%dbit%s_b%d.wav", outDir,
+           TR::SR, TR::OS, TR::BITS, TR::PACK24 ? "p" : "", TR::BLOCK_FRAMES);
+  WavWriter wav;
+  if (!wav.open(path, TR::SR, TR::STEREO ? 2 : 1, TR::SAMPLE_BYTES)) {
+    Log.errorln("[bench] cannot open %s", path);
+  }
+
+  const uint64_t totalBlocks =
+      uint64_t(seconds * float(TR::SR)) / uint64_t(TR::BLOCK_FRAMES);
+
+  auto frameOf = [](float sec) {
+    return uint64_t(sec * float(TR::SR) + 0.5f);
+  };
+
+  Stats st;
+  size_t nextStep = 0;
+  std::array<audio::Event, Steps::kSteps.size()> events;
+  for (uint64_t b = 0; b < totalBlocks; ++b) {
+    const uint64_t f0 = b * TR::BLOCK_FRAMES;
+    size_t nEvents = 0;
+    while (nextStep < Steps::kSteps.size() &&
+           frameOf(Steps::kSteps[nextStep].atSec) < f0 + TR::BLOCK_FRAMES) {
+      const auto& step = Steps::kSteps[nextStep++];
+      step.apply(cfg);
+      cfg.bumpAll();  // steps touch several sections
+      events[nEvents++] = {.offset = uint16_t(frameOf(step.atSec) - f0),
+                           .type = audio::Event::Trigger};
+    }
+
+    const auto t0 = Clock::now();
+    app.fillBlock(buf, {events.data(), nEvents});
+    const auto t1 = Clock::now();
+
+    const uint64_t ns =
+        uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0)
+                     .count());
+    st.totalNs += ns;
+    st.worstNs = std::max(st.worstNs, ns);
+    ++st.blocks;
+    st.frames += TR::BLOCK_FRAMES;
+
+    wav.write(buf.data(), TR::BLOCK_BYTES);
+  }
+  wav.close();
+
+  const double nsPerFrame = st.frames ? double(st.totalNs) / st.frames : 0.0;
+  const double blocksPerSec =
+      st.totalNs ? double(st.blocks) * 1e9 / double(st.totalNs) : 0.0;
+  const double budgetUs = 1e6 * TR::BLOCK_FRAMES / double(TR::SR);
+  const double rtFactor =
+      budgetUs > 0.0 ? blocksPerSec * budgetUs * 1e-6 : 0.0;
+  printf(
+      "[bench] SR=%d OS=%d BITS=%d%s BLOCK=%d: %.1f ns/frame, %.0f blocks/s "
+      "(%.1fx RT), worst %.2f us of %.2f us budget, clips=%d -> %s\n",
+      TR::SR, TR::OS, TR::BITS, TR::PACK24 ? "p" : "", TR::BLOCK_FRAMES,
+      nsPerFrame, blocksPerSec, rtFactor, double(st.worstNs) * 1e-3, budgetUs,
+      fb.saturationCounter, path);
+  return st;
+}
+
+template <class... TRs>
+void renderAll(float seconds, const char* outDir) {
+  (render<TRs>(seconds, outDir), ...);
+}
+
+}  // namespace zlkm::bench
+
+int main(int argc, char** argv) {
+  using zlkm::audio::AudioTraits;
+  const float seconds = argc > 1 ? float(atof(argv[1])) : 4.f;
+  const char* outDir = argc > 2 ? argv[2] : ".";
+
+  zlkm::bench::renderAll<AudioTraits<48000, 1, 32, 64>,  // CalcisTR
+                         AudioTraits<48000, 1, 32, 32>,
+                         AudioTraits<48000, 1, 32, 128>,
+                         AudioTraits<48000, 2, 32, 64>,
+                         AudioTraits<48000, 4, 32, 64>,
+                         AudioTraits<48000, 1, 16, 64>,
+                         AudioTraits<48000, 1, 24, 64>,
+                         AudioTraits<48000, 1, 24, 64, true, true>,
+                         AudioTraits<96000, 1, 32, 64>>(seconds, outDir);
+  return 0;
+}
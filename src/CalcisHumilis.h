@@ -7,25 +7,43 @@
 #include <Stream.h>
 
 #include "audio/DJFilter.h"
+#include "audio/Event.h"
 #include "audio/MorphOsc.h"
+#include "audio/Pcm.h"
+#include "audio/engine/EngineSlot.h"
+#include "audio/engine/FM.h"
 #include "audio/engine/Swarm.h"
+#include "dsp/Decimator.h"
+#include "dsp/SoftClip.h"
+#include "math/Fast.h"
 #include "mod/ADEnvelopes.h"
+#include "mod/ModMatrix.h"
 #include "platform/platform.h"
+#include "util/Profiler.h"
+#include "util/SpscQueue.h"
 
 namespace zlkm::ch {
 
-// -------------------- NEW: OS template param --------------------
-// NTAPS is configurable; 63 is a decent default for 2–4x OS.
+// Everything up to the soft clipper runs at SR * TR::OS on blocks of
+// BLOCK_FRAMES * OS samples; a half-band cascade decimates back to SR.
+// Cfg stays in output-rate units (cycles per SR sample, SR-normalized
+// envelope rates) and is rescaled internally.
 template <class TR>
 class CalcisHumilis {
   static constexpr int SR = TR::SR;
   static constexpr int OS = TR::OS;
+  static_assert(OS == 1 || OS == 2 || OS == 4, "OS must be 1, 2 or 4");
+  static constexpr int OS_FRAMES = TR::BLOCK_FRAMES * OS;
   using OutBuffer = typename TR::BufferT;
-  using IntBuffer = std::array<float, TR::BLOCK_ELEMS>;
+  using BlockBuf = std::array<float, OS_FRAMES>;  // one internal block
 
   static constexpr float INV_SR = 1.f / float(SR);
+  static constexpr float INV_OS = 1.f / float(OS);
 
  public:
+  static constexpr int INTERNAL_SR = SR * OS;
+  static constexpr int INTERNAL_FRAMES = OS_FRAMES;  // per renderBlock()
+
 #ifdef DEBUG
   static constexpr int MAX_SWARM_VOICES = 8;
 #else
@@ -35,12 +53,19 @@ class CalcisHumilis {
   static constexpr float rate(float ms) { return dsp::msToRate(ms, SR); }
   static constexpr float cycles(float hz) { return hz * INV_SR; }
 
-  using Swarm = audio::engine::SwarmMorph<MAX_SWARM_VOICES, SR * OS>;
+  using Swarm = audio::engine::SwarmMorph<MAX_SWARM_VOICES, INTERNAL_SR>;
   using SwarmCfg = typename Swarm::Cfg;
-  using Filter = audio::DJFilterTPT<SR * OS>;
+  using Filter = audio::DJFilterTPT<INTERNAL_SR>;
   using FilterCfg = typename Filter::Cfg;
+  static constexpr int FM_OPS = 4;
+  using FM = audio::engine::FM<FM_OPS>;
+  using FMCfg = typename FM::Cfg;
 
-  enum OscMode { OscSwarm = 0, OscCount };
+  // Sound engine, switched at a block boundary when cold.oscMode changes.
+  // Engines holds one type per OscMode, in order.
+  enum OscMode { OscSwarm = 0, OscFM, OscCount };
+  using Engines = audio::engine::EngineSlot<Swarm, FM>;
+  static_assert(Engines::size() == OscCount);
 
   enum Envs {
     EnvAmp = 0,
@@ -55,66 +80,355 @@ class CalcisHumilis {
   using Envelopes = mod::ADEnvelopes<EnvCount>;
   using EnvCfg = mod::EnvCfg;
 
+  // Mod matrix destinations (sources are the envelopes) and route depth
+  // units. Each adds to the hard-wired modulation already there.
+  enum ModDest {
+    DestPitch = 0,  // semitones, per sample
+    DestAmp,        // amp envelope level, clamped 0..1, per sample
+    DestSwarm,      // swarm envelope level, clamped 0..1, per sample
+    DestMorph,      // morph envelope level, clamped 0..1, per sample
+    DestCutoff,     // octaves, every kModChunk frames
+    DestCount
+  };
+  static constexpr int kMaxRoutes = 16;
+  using ModMatrix = mod::ModMatrix<EnvCount, DestCount, kMaxRoutes>;
+
+  // Each trigger takes a voice (envelopes, engine, filter) from a fixed
+  // pool, so a new hit no longer cuts the previous one's tail. With every
+  // voice busy, one is given up per cold.voiceSteal.
+  static constexpr int kVoices = 4;
+  enum VoiceSteal { StealQuietest = 0, StealOldest };
+
+  // True if 'field' points into 'm'
+  template <class M>
+  static bool within(const void* field, const M& m) {
+    const auto* p = static_cast<const uint8_t*>(field);
+    const auto* b = reinterpret_cast<const uint8_t*>(&m);
+    return p >= b && p < b + sizeof(m);
+  }
+
+  // Split by how often the engine looks: 'hot' holds the block-interpolated
+  // targets and is read every block, 'cold' is only consumed when its
+  // version moves. Each crosses cores through its own queue (see
+  // util::SplitParamQueue), so cold additions never grow the hot transfer.
   struct Cfg {
-    OscMode oscMode = OscSwarm;
-
-    SwarmCfg swarmOsc;
-
-    float outGain = .7f;
-    float cyclesPerSample = cycles(65.f);
+    struct alignas(32) Hot {
+      float outGain = .7f;
+      float cyclesPerSample = cycles(65.f);
+
+      // Interpolated floats; its voices/morphMode/randomPhase ride along
+      // and are applied only when versions.swarm moves
+      SwarmCfg swarmOsc;
+
+      FilterCfg filter;  // coefficients for INTERNAL_SR
+
+      // Ratios/levels/feedback interpolated; algorithm applied when
+      // versions.fm moves
+      FMCfg fm;
+
+      int trigCounter = 0;
+
+      // Per-section edit counters: writers bump the section of every field
+      // they change, and fillBlock skips per-block setup for sections whose
+      // counter did not move
+      struct Versions {
+        uint32_t control = 0;  // outGain, cyclesPerSample
+        uint32_t swarm = 0;
+        uint32_t filter = 0;
+        uint32_t fm = 0;
+      };
+      Versions versions;
+
+      void bumpAll() {
+        ++versions.control;
+        ++versions.swarm;
+        ++versions.filter;
+        ++versions.fm;
+      }
+
+      // Counter of the section holding 'field'; nullptr for fields read
+      // afresh every block (trigCounter) and fields outside Hot
+      uint32_t* sectionVersion(const void* field) {
+        if (within(field, swarmOsc)) return &versions.swarm;
+        if (within(field, filter)) return &versions.filter;
+        if (within(field, fm)) return &versions.fm;
+        if (within(field, outGain) || within(field, cyclesPerSample)) {
+          return &versions.control;
+        }
+        return nullptr;
+      }
+    };
 
-    std::array<EnvCfg, EnvCount> envs = {
-        EnvCfg{rate(1.f), rate(330.f)},         // amp
-        EnvCfg{rate(10.f), rate(20.f), 8.f},    // pitch
-        EnvCfg{rate(1.f), rate(6.f), .2f},      // click
-        EnvCfg{rate(200.f), rate(500.f), 1.f},  // swarm
-        EnvCfg{rate(10.f), rate(200.f), 1.f},   // morph
-        EnvCfg{rate(1.f), rate(60.f), 1.f},     // filter
+    struct Cold {
+      OscMode oscMode = OscSwarm;
+      VoiceSteal voiceSteal = StealQuietest;
+
+      std::array<EnvCfg, EnvCount> envs = {
+          EnvCfg{rate(1.f), rate(330.f)},         // amp
+          EnvCfg{rate(10.f), rate(20.f), 38.f},   // pitch, depth in semis
+          EnvCfg{rate(1.f), rate(6.f), .2f},      // click
+          EnvCfg{rate(200.f), rate(500.f), 1.f},  // swarm
+          EnvCfg{rate(10.f), rate(200.f), 1.f},   // morph
+          EnvCfg{rate(1.f), rate(60.f), 1.f},     // filter
+      };
+
+      // FM operator envelopes, operator 0 (carrier) first
+      std::array<EnvCfg, FM_OPS> fmEnvs = {
+          EnvCfg{rate(.5f), rate(450.f)},
+          EnvCfg{rate(.5f), rate(120.f)},
+          EnvCfg{rate(.5f), rate(50.f)},
+          EnvCfg{rate(.5f), rate(25.f)},
+      };
+
+      std::array<mod::Route, kMaxRoutes> routes{};  // src: Envs, dst: ModDest
+
+      uint32_t version = 0;  // any cold field
+
+      uint32_t* sectionVersion(const void* field) {
+        return within(field, *this) ? &version : nullptr;
+      }
     };
 
-    FilterCfg filter;
+    Hot hot;
+    Cold cold;
 
-    int trigCounter = 0;
+    void bumpAll() {
+      hot.bumpAll();
+      ++cold.version;
+    }
 
-    bool kPack24In32 = false;
+    // Counter of the section holding 'field'; nullptr for fields read
+    // afresh every block (trigCounter)
+    uint32_t* sectionVersion(const void* field) {
+      if (uint32_t* v = cold.sectionVersion(field)) return v;
+      return hot.sectionVersion(field);
+    }
   };
+  // What every block reads; keep it small
+  static_assert(sizeof(typename Cfg::Hot) <= 128);
 
   struct Feedback {
     int saturationCounter = 0;
+    // Output device, kept up to date by AudioCore
+    uint32_t underruns = 0;   // device ran dry
+    uint32_t nearMisses = 0;  // block arrived with under half a block left
   };
 
-  explicit CalcisHumilis(const Cfg* cfg, Feedback* fb);
+  // Per-block record for meters and scopes, core 1 -> core 0. Levels are
+  // taken from the clipped output-rate signal.
+  static constexpr int SCOPE_POINTS = std::min(16, TR::BLOCK_FRAMES);
+  struct Telemetry {
+    std::array<float, 2> peak{};        // max |x| per channel
+    std::array<float, 2> rms{};         // per channel
+    std::array<float, EnvCount> env{};  // newest voice, at block end
+    uint32_t renderUs = 0;              // fillBlock wall time
+    std::array<float, SCOPE_POINTS> scope{};  // mono, evenly spaced frames
+  };
+  // Full ring drops new records; the UI only wants the latest ones
+  using TelemetryRing = util::SpscQueue<Telemetry, 32>;
+
+  CalcisHumilis(const Cfg* cfg, Feedback* fb,
+                TelemetryRing* telemetry = nullptr);
+  // Sections held apart, e.g. in arrays of a kit's Cfg
+  CalcisHumilis(const typename Cfg::Hot* hot, const typename Cfg::Cold* cold,
+                Feedback* fb, TelemetryRing* telemetry = nullptr);
 
+  // Hit at frame 0 of the next block
   void trigger();
   void tickLED();
 
-  // Fill an interleaved stereo block (nFrames = stereo frames)
-  void fillBlock(OutBuffer& destLR);
+  // Fill an interleaved stereo block (nFrames = stereo frames). 'events'
+  // are sorted by offset; triggers fire on their exact frame. A trigCounter
+  // edge in Cfg fires at frame 0.
+  void fillBlock(OutBuffer& destLR, std::span<const audio::Event> events = {});
+
+  // One block at the internal rate (INTERNAL_FRAMES per channel), before
+  // the output clipper and decimator, for hosts that mix several
+  // instances: they clip the sum oversampled and decimate it once. Empty
+  // spans while parked (silence). The data lives in scratch shared by all
+  // instances: use it before the next instance renders.
+  struct Block {
+    std::span<const float> l, r;
+  };
+  Block renderBlock(std::span<const audio::Event> events = {});
+
+  // Fade out whatever sounds at output frame 'offset' of the next block,
+  // including hits of that block before it (choke groups)
+  void choke(int offset);
+
+  // Newest voice's envelope levels at the end of the last block
+  const std::array<float, EnvCount>& envLevels() const { return envLevels_; }
+
+  // Voices sounding or fading
+  int activeVoices() const {
+    return int(std::count_if(voices_.begin(), voices_.end(),
+                             [](const Voice& v) { return v.active; }));
+  }
+
+  // Peak, RMS and scope of an output block into 't'
+  static void measure(std::span<const float> l, std::span<const float> r,
+                      Telemetry& t);
 
  private:
-  float softClip(float x);
+  // Amp envelope level below which the filters are parked at zero state
+  static constexpr float kSilentAmp = 1e-5f;
+  // Fade-out of a voice given up so the next hit finds one free
+  static constexpr int kFadeFrames = INTERNAL_SR / 500;  // 2 ms
+  static constexpr float kInvFade = 1.f / float(kFadeFrames);
+
+  // Cutoff modulation: one exact coefficient per chunk, ramped in between
+  static constexpr int kModChunk = std::min(16, OS_FRAMES);
+  static_assert(OS_FRAMES % kModChunk == 0);
+  static constexpr float kModCutMin = 20.f / float(INTERNAL_SR);
+  static constexpr float kModCutMax =
+      audio::DJFilterLimitsDefault::kHardTopHz / float(INTERNAL_SR);
+
+  // Trigger positions of one block in internal frames, ascending. Triggers
+  // beyond kMaxTriggers in a single block are dropped.
+  static constexpr int kMaxTriggers = 8;
+  struct Triggers {
+    std::array<int, kMaxTriggers> at;
+    int count = 0;
+  };
 
-  static inline float hzToPitch(float hz) { return log2f(hz); }
-  static inline float pitchToHz(float pit) { return exp2f(pit); }
-  static inline float semisToPitch(float s) { return s / 12.0f; }
+  // One hit's worth of state. Idle voices (active == false) are skipped;
+  // a voice started mid-block renders from its first trigger on.
+  struct Voice {
+    Envelopes env;
+    Engines engine;
+    Filter filterL, filterR;
+    FilterCfg fCfg;
+    bool filterModded = false;  // fCfg holds a modulated cutoff
+    bool active = false;
+    bool fading = false;
+    // Taken for a hit while fading: fades until trig.at[0], restarts there
+    bool reclaimed = false;
+    int fadeLeft = 0;     // frames until silent while fading
+    int fadeFrom = 0;     // fade starts at this frame of the current block
+    int chokeFrom = -1;   // reclaimed, then choked: fades again from here
+    int from = 0;         // first frame rendered this block
+    uint32_t serial = 0;  // trigger order, for StealOldest
+    Triggers trig;        // restarts within the current block
+    // Engine and filter sections as of the voice's last block
+    typename Cfg::Hot::Versions seen;
+  };
 
-  const Cfg* cfg_;
+  bool renderVoices_(std::span<const audio::Event> events, bool& idle);
+  void updateColdCfg_();
+  bool selectEngine_(Voice& v);
+  void allocate_(const Triggers& trig);
+  void fadeAll_(int at);
+  Voice& claim_();
+  Voice* victim_(bool spareThisBlock);
+  void start_(Voice& v);
+  void retire_(Voice& v);
+  void control_();
+  void renderVoice_(Voice& v);
+  void render_(Voice& v, Swarm& swarm);
+  void render_(Voice& v, FM& fm);
+  const BlockBuf& modulated_(ModDest dst, const BlockBuf& base, float lo,
+                             float hi, int from);
+  void filterModulated_(Voice& v);
+  void advanceSilent_();
+  void park_();
+  Triggers collectTriggers_(std::span<const audio::Event> events);
+  void publishTelemetry_(std::span<const float> l, std::span<const float> r,
+                         uint32_t t0Us);
+
+  // seg(from, n) over the pieces of the block between triggers, starting
+  // at 'from', onTrigger() at each trigger position
+  template <class Seg, class OnTrigger>
+  static void splitAtTriggers_(const Triggers& tr, int from, Seg&& seg,
+                               OnTrigger&& onTrigger) {
+    for (int t = 0; t <= tr.count; ++t) {
+      const int to = t < tr.count ? tr.at[t] : OS_FRAMES;
+      if (to > from) seg(from, to - from);
+      if (t < tr.count) onTrigger();
+      from = to;
+    }
+  }
+
+  // Pitch domain: octaves, pitch = log2(cycles per internal sample).
+  // cyclesToPitch takes Cfg units (cycles per SR sample) once per block
+  // (High tier); pitchToCycles runs per sample (Mid tier).
+  using Tier = math::fast::Tier;
+  static inline float cyclesToPitch(float c) {
+    return math::fast::log2<Tier::High>(c * INV_OS);
+  }
+  static inline float pitchToCycles(float pit) {
+    return math::fast::exp2<Tier::Mid>(pit);
+  }
+  static inline float semisToPitch(float s) { return s * (1.f / 12.f); }
+
+  // Envelope rates come per SR sample; envelopes here tick at INTERNAL_SR
+  template <size_t N>
+  static const std::array<EnvCfg, N>& internalRates_(
+      const std::array<EnvCfg, N>& envs, std::array<EnvCfg, N>& scratch) {
+    if constexpr (OS == 1) {
+      return envs;
+    } else {
+      for (size_t e = 0; e < N; ++e) {
+        scratch[e] = envs[e];
+        scratch[e].attack *= INV_OS;
+        scratch[e].decay *= INV_OS;
+      }
+      return scratch;
+    }
+  }
+
+  // Cfg section of each engine, which it is also constructed from
+  const SwarmCfg& engineCfg_(audio::engine::Tag<Swarm>) const {
+    return hot_->swarmOsc;
+  }
+  const FMCfg& engineCfg_(audio::engine::Tag<FM>) const {
+    return hot_->fm;
+  }
+
+  const typename Cfg::Hot* hot_;
+  const typename Cfg::Cold* cold_;
   Feedback* fb_;
+  TelemetryRing* telemetry_;
 
-  Envelopes envelopes_;
+  std::array<EnvCfg, EnvCount> envCfgOs_;  // rates rescaled to INTERNAL_SR
+  std::array<EnvCfg, FM_OPS> fmEnvCfgOs_;  // likewise, FM operators
 
+  // Block-interpolated together (adjacent): out gain and base pitch
   float outGain_;
-  float cyclesPerSample_;
-
-  // Oscillators run at OS*SR so their phase math sees true step size
-  Swarm swarm;
-  FilterCfg fCfg_;
+  float pitch_;
+  bool ctlRamp_ = false;  // this block ramps them (see ctlGain_/ctlPitch_)
 
   float currentPan = 0.5f;
 
-  Filter filterL, filterR;
+  // Oscillators run at OS*SR so their phase math sees true step size
+  std::array<Voice, kVoices> voices_;
+  uint32_t serial_ = 0;
+  bool trigPending_ = false;  // trigger() since the last block
+  Triggers chokes_;           // choke() since the last block, ascending
+
+  ModMatrix matrix_;  // compiled from cold.routes
+  dsp::Decimator<OS, OS_FRAMES> decimL_, decimR_;
 
   int trigCounter_ = 0;
+  // Section versions as of the last block
+  typename Cfg::Hot::Versions seen_;
+  uint32_t seenCold_;
+  // No voice active and one full silent block rendered since: output is
+  // exact zero and the decimators are flushed, so fillBlock can skip DSP.
+  // Voices were reset when they retired: the next hit starts from scratch.
+  bool parked_ = false;
+
+  std::array<float, EnvCount> envLevels_{};  // newest voice, for telemetry
+
+  // Per-block scratch: one buffer per stage output, reused voice by voice.
+  // Static: instances render one after another on the audio core, so they
+  // share it too.
+  static inline BlockBuf ctlGain_{}, ctlPitch_{};  // when ramping
+  static inline std::array<BlockBuf, EnvCount> envBuf_{};
+  static inline BlockBuf pitchBuf_{};  // cycles per internal sample
+  static inline BlockBuf gainBuf_{};   // out gain * amp envelope
+  static inline std::array<BlockBuf, DestCutoff> modBuf_{};  // modulated
+  static inline BlockBuf bufL_{}, bufR_{};
+  static inline BlockBuf mixL_{}, mixR_{};  // sum of the voices, gained
 };
 
 }  // namespace zlkm::ch
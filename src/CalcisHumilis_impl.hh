@@ -1,124 +1,569 @@
 #include <ArduinoLog.h>
 #include <math.h>
 
+#include <algorithm>
+
 #include "CalcisHumilis.h"
 #include "mod/BlockInterpolator.h"
 
 namespace zlkm::ch {
 
 template <class TR>
-float CalcisHumilis<TR>::softClip(float x) {
-  const float t = 0.95f;
-  const bool isClip = (x > t) || (x < -t);
-  if (isClip) ++fb_->saturationCounter;
-  if (x > t) return t + (x - t) * 0.05f;
-  if (x < -t) return -t + (x + t) * 0.05f;
-  return x;
-}
+CalcisHumilis<TR>::CalcisHumilis(const Cfg *cfg, Feedback *fb,
+                                 TelemetryRing *telemetry)
+    : CalcisHumilis(&cfg->hot, &cfg->cold, fb, telemetry) {}
 
 template <class TR>
-CalcisHumilis<TR>::CalcisHumilis(const Cfg *cfg, Feedback *fb)
-    : cfg_(cfg),
+CalcisHumilis<TR>::CalcisHumilis(const typename Cfg::Hot *hot,
+                                 const typename Cfg::Cold *cold,
+                                 Feedback *fb, TelemetryRing *telemetry)
+    : hot_(hot),
+      cold_(cold),
       fb_(fb),
-      outGain_(cfg_->outGain),
-      cyclesPerSample_(cfg_->cyclesPerSample),
-      swarm(cfg->swarmOsc) {}
+      telemetry_(telemetry),
+      outGain_(hot->outGain),
+      pitch_(cyclesToPitch(hot->cyclesPerSample)),
+      seen_(hot->versions),
+      seenCold_(cold->version) {
+  for (Voice &v : voices_) selectEngine_(v);
+  updateColdCfg_();
+}
 
 template <class TR>
 void CalcisHumilis<TR>::trigger() {
-  envelopes_.triggerAll();
-  swarm.reset();
+  trigPending_ = true;
 }
 
-template <size_t N>
-static inline void array_float_to_int32(const std::array<float, N> &src,
-                                        std::array<int32_t, N> &dst) {
-  for (size_t i = 0; i < N; ++i) {
-    float x = src[i] * 2147483647.0f;
-    x = fmaxf(-2147483648.0f, fminf(2147483647.0f, x));
-    dst[i] = (int32_t)x;
+// Kept in frame order until allocate_ lays out the next block
+template <class TR>
+void CalcisHumilis<TR>::choke(int offset) {
+  if (chokes_.count == kMaxTriggers) return;
+  const int at = std::min(offset, TR::BLOCK_FRAMES - 1) * OS;
+  int i = chokes_.count++;
+  for (; i > 0 && chokes_.at[i - 1] > at; --i) {
+    chokes_.at[i] = chokes_.at[i - 1];
   }
+  chokes_.at[i] = at;
 }
 
+// Choke at internal frame 'at': every voice sounding starts fading there.
+// One taken back earlier in the block fades again after its new hit.
 template <class TR>
-void CalcisHumilis<TR>::fillBlock(OutBuffer &destLR) {
-  ZLKM_PERF_SCOPE("CalcisHumilis<TR>::fillBlock");
+void CalcisHumilis<TR>::fadeAll_(int at) {
+  for (Voice &v : voices_) {
+    if (!v.active || v.fading) continue;
+    if (v.reclaimed) {
+      if (v.chokeFrom < 0) v.chokeFrom = at;
+      continue;
+    }
+    v.fading = true;
+    v.fadeLeft = kFadeFrames;
+    v.fadeFrom = at;
+  }
+}
+
+template <class TR>
+void CalcisHumilis<TR>::updateColdCfg_() {
+  const auto &envs = internalRates_(cold_->envs, envCfgOs_);
+  const auto &fmEnvs = internalRates_(cold_->fmEnvs, fmEnvCfgOs_);
+  for (Voice &v : voices_) {
+    v.env.setEnvs(envs);
+    if (FM *fm = v.engine.template get<FM>()) fm->setEnvs(fmEnvs);
+  }
+  matrix_.compile(cold_->routes);
+}
+
+// Hand each trigger a voice. When that leaves none free, another voice
+// starts fading out on the same frame, so the next hit normally finds a
+// free one instead of cutting a tail. A fading voice taken for a hit keeps
+// fading up to the hit's frame and restarts from zero there. Pending
+// chokes apply in frame order with the hits, so a choke fades hits before
+// it in the same block but not those on or after its frame.
+template <class TR>
+void CalcisHumilis<TR>::allocate_(const Triggers &trig) {
+  for (Voice &v : voices_) {
+    v.trig.count = 0;
+    v.from = 0;
+  }
+  int c = 0;
+  for (int t = 0; t < trig.count; ++t) {
+    const int at = trig.at[t];
+    for (; c < chokes_.count && chokes_.at[c] <= at; ++c) {
+      fadeAll_(chokes_.at[c]);
+    }
+    Voice &v = claim_();
+    if (!v.active) {
+      start_(v);
+      v.from = at;
+    }
+    v.reclaimed = v.fading;
+    v.fading = false;
+    v.chokeFrom = -1;
+    v.serial = ++serial_;
+    v.trig.at[v.trig.count++] = at;
+    if constexpr (kVoices > 1) {
+      const bool spare =
+          std::any_of(voices_.begin(), voices_.end(),
+                      [](const Voice &u) { return !u.active || u.fading; });
+      Voice *u = spare ? nullptr : victim_(true);
+      if (u) {
+        u->fading = true;
+        u->fadeLeft = kFadeFrames;
+        u->fadeFrom = at;
+      }
+    }
+  }
+  for (; c < chokes_.count; ++c) fadeAll_(chokes_.at[c]);
+  chokes_.count = 0;
+}
 
-  using namespace zlkm::mod;
+// A free voice, else the fading one nearest silence, else a victim
+// restarted in place
+template <class TR>
+typename CalcisHumilis<TR>::Voice &CalcisHumilis<TR>::claim_() {
+  Voice *fading = nullptr;
+  for (Voice &v : voices_) {
+    if (!v.active) return v;
+    if (v.fading && (!fading || v.fadeLeft < fading->fadeLeft)) fading = &v;
+  }
+  return fading ? *fading : *victim_(false);
+}
 
-  if (cfg_->trigCounter > trigCounter_) {
-    trigCounter_ = cfg_->trigCounter;
-    trigger();
+// Active voice not already fading to give up, per cold.voiceSteal: lowest
+// amp level (older on a tie) or oldest. spareThisBlock skips voices
+// triggered in the current block, whose level has not risen yet.
+template <class TR>
+typename CalcisHumilis<TR>::Voice *CalcisHumilis<TR>::victim_(
+    bool spareThisBlock) {
+  const bool byAge = cold_->voiceSteal == StealOldest;
+  Voice *pick = nullptr;
+  for (Voice &v : voices_) {
+    if (!v.active || v.fading || (spareThisBlock && v.trig.count)) continue;
+    if (!pick) {
+      pick = &v;
+      continue;
+    }
+    const bool older = int32_t(v.serial - pick->serial) < 0;
+    const float lv = v.env.value(EnvAmp), lp = pick->env.value(EnvAmp);
+    if (byAge ? older : lv < lp || (lv == lp && older)) pick = &v;
   }
-  envelopes_.setEnvs(cfg_->envs);
+  return pick;
+}
 
-  auto swarmCfgItp = makeBlockInterpolator<TR::BLOCK_FRAMES>(
-      swarm.cfg().i_begin(), cfg_->swarmOsc.asTarget());
+// An idle voice catches up with the current targets; its engine and
+// envelopes restart on its trigger frame
+template <class TR>
+void CalcisHumilis<TR>::start_(Voice &v) {
+  v.engine.visit([this](auto &e) {
+    e.park(engineCfg_(audio::engine::Tag<std::decay_t<decltype(e)>>{}));
+  });
+  v.seen = hot_->versions;
+  v.fCfg = hot_->filter;
+  v.filterModded = false;
+  v.active = true;
+}
 
-  auto calcisCfgItp = makeBlockInterpolator<TR::BLOCK_FRAMES, 2>(
-      &outGain_, {cfg_->outGain, cfg_->cyclesPerSample});
+// Silent (amp envelope done or fade complete): the next hit on this voice
+// starts from zero
+template <class TR>
+void CalcisHumilis<TR>::retire_(Voice &v) {
+  v.env.resetAll();
+  v.filterL.reset();
+  v.filterR.reset();
+  v.active = false;
+  v.fading = false;
+}
 
-  auto filterCfgItp = makeBlockInterpolator<TR::BLOCK_FRAMES>(
-      &fCfg_.gCut, cfg_->filter.asTarget());
+// Out gain and base pitch, shared by the voices. On a change both glide to
+// the target over the block, pitch linearly in octaves.
+template <class TR>
+void CalcisHumilis<TR>::control_() {
+  const auto &ver = hot_->versions;
+  ctlRamp_ = ver.control != seen_.control;
+  if (!ctlRamp_) return;
+  seen_.control = ver.control;
+  const std::array<float, 2> target = {
+      hot_->outGain, cyclesToPitch(hot_->cyclesPerSample)};
+  auto calcisCfgItp =
+      mod::makeBlockInterpolator<OS_FRAMES, 2>(&outGain_, target);
+  for (size_t i = 0; i < OS_FRAMES; ++i) {
+    calcisCfgItp.update();
+    ctlGain_[i] = outGain_;
+    ctlPitch_[i] = pitch_;
+  }
+  outGain_ = target[0];
+  pitch_ = target[1];
+}
 
-  IntBuffer buffer;
-  for (size_t i = 0; i < TR::BLOCK_FRAMES; ++i) {
-    {
-      ZLKM_PERF_SCOPE("envelopes");
-      envelopes_.update();
-    }
+// One voice from v.from to the block end, added to the mix with its gain
+template <class TR>
+void CalcisHumilis<TR>::renderVoice_(Voice &v) {
+  const int from = v.from;
 
-    {
-      ZLKM_PERF_SCOPE("interpolators");
-      swarmCfgItp.update();
-      calcisCfgItp.update();
-      filterCfgItp.update();
+  // Envelopes and oscillators restart on the trigger frame; everything
+  // downstream runs on the rest of the block in one piece
+  {
+    ZLKM_PERF_SCOPE("envelopes");
+    bool fromZero = v.reclaimed;
+    splitAtTriggers_(
+        v.trig, from,
+        [&](int f, int n) {
+          for (int e = 0; e < EnvCount; ++e) {
+            v.env.processBlock(e,
+                               std::span<float>(envBuf_[e]).subspan(f, n));
+          }
+        },
+        [&] {
+          if (fromZero) v.env.resetAll();
+          fromZero = false;
+          v.env.triggerAll();
+        });
+  }
 
-      swarm.cfgUpdated();
+  {
+    ZLKM_PERF_SCOPE("control");
+    // The pitch envelope adds semitones on top of the base pitch, so a
+    // sweep spans the same interval at any pitch
+    const BlockBuf &amp =
+        modulated_(DestAmp, envBuf_[EnvAmp], 0.f, 1.f, from);
+    const BlockBuf &semis =
+        modulated_(DestPitch, envBuf_[EnvPitch], -96.f, 96.f, from);
+    if (ctlRamp_) {
+      for (int i = from; i < OS_FRAMES; ++i) {
+        pitchBuf_[i] = pitchToCycles(ctlPitch_[i] + semisToPitch(semis[i]));
+        gainBuf_[i] = ctlGain_[i] * amp[i];
+      }
+    } else {
+      for (int i = from; i < OS_FRAMES; ++i) {
+        pitchBuf_[i] = pitchToCycles(pitch_ + semisToPitch(semis[i]));
+        gainBuf_[i] = outGain_ * amp[i];
+      }
+    }
+    if (v.reclaimed) {
+      // The old hit has to be silent by the new one: its fade is sped up
+      // to end there, from the level it had reached
+      const int start = std::max(from, v.fadeFrom), end = v.trig.at[0];
+      const int n = std::min(v.fadeLeft, end - start);
+      const float step = n > 0 ? float(v.fadeLeft) * kInvFade / float(n) : 0.f;
+      for (int i = start; i < end; ++i) {
+        gainBuf_[i] *= step * float(std::max(n - (i - start), 0));
+      }
+      v.fadeFrom = 0;
+      v.reclaimed = false;
+      if (v.chokeFrom >= 0) {
+        v.fading = true;
+        v.fadeLeft = kFadeFrames;
+        v.fadeFrom = v.chokeFrom;
+        v.chokeFrom = -1;
+      }
     }
+    if (v.fading) {
+      for (int i = std::max(from, v.fadeFrom); i < OS_FRAMES; ++i) {
+        gainBuf_[i] *= float(v.fadeLeft) * kInvFade;
+        v.fadeLeft -= v.fadeLeft > 0;
+      }
+      v.fadeFrom = 0;
+    }
+  }
 
-    const float g = outGain_;
+  // One dispatch per voice and block; the engine's own loop runs per sample
+  v.engine.visit([&](auto &e) { render_(v, e); });
 
-    // ---------- No oversampling path ----------
-    const float a = envelopes_.value(EnvAmp);
+  {
+    ZLKM_PERF_SCOPE("filter");
+    const auto &ver = hot_->versions;
+    const std::span<float> l = std::span<float>(bufL_).subspan(from);
+    const std::span<float> r = std::span<float>(bufR_).subspan(from);
+    if (matrix_.routed(DestCutoff)) {
+      filterModulated_(v);
+    } else if (ver.filter != v.seen.filter || v.filterModded) {
+      // Also ramps back from the last modulated cutoff
+      v.seen.filter = ver.filter;
+      v.filterModded = false;
+      v.filterL.processBlock(l, l, v.fCfg, hot_->filter);
+      v.filterR.processBlock(r, r, v.fCfg, hot_->filter);
+      v.fCfg = hot_->filter;
+    } else {
+      v.filterL.processBlock(l, l, v.fCfg);
+      v.filterR.processBlock(r, r, v.fCfg);
+    }
+    if (envBuf_[EnvAmp].back() < kSilentAmp) {
+      v.filterL.reset();
+      v.filterR.reset();
+    }
+  }
 
-    if (a < 1e-5) {
-      filterL.reset();
-      filterR.reset();
+  {
+    ZLKM_PERF_SCOPE("mix");
+    for (int i = from; i < OS_FRAMES; ++i) {
+      mixL_[i] += bufL_[i] * gainBuf_[i];
+      mixR_[i] += bufR_[i] * gainBuf_[i];
     }
+  }
 
-    const float p = envelopes_.value(EnvPitch);
-    const float c = envelopes_.value(EnvClick);
-    const float sw = envelopes_.value(EnvSwarm);
-    const float m = envelopes_.value(EnvMorph);
-    const float f = envelopes_.value(EnvFilter);
+  if (v.serial == serial_) {
+    for (int e = 0; e < EnvCount; ++e) envLevels_[e] = envBuf_[e].back();
+  }
+  if (!v.env.isActive(EnvAmp) || (v.fading && !v.fadeLeft)) retire_(v);
+}
 
-    float &l = buffer[2 * i + 0];
-    float &r = buffer[2 * i + 1];
-    l = r = 0.f;
+// Swarm over the pieces between triggers; a param ramp completes within
+// the first piece
+template <class TR>
+void CalcisHumilis<TR>::render_(Voice &v, Swarm &swarm) {
+  const auto &ver = hot_->versions;
+  bool swarmChanged = ver.swarm != v.seen.swarm;
+  v.seen.swarm = ver.swarm;
+  const BlockBuf &swarmEnv =
+      modulated_(DestSwarm, envBuf_[EnvSwarm], 0.f, 1.f, v.from);
+  const BlockBuf &morphEnv =
+      modulated_(DestMorph, envBuf_[EnvMorph], 0.f, 1.f, v.from);
+  splitAtTriggers_(
+      v.trig, v.from,
+      [&](int from, int n) {
+        auto sub = [&](BlockBuf &b) {
+          return std::span<float>(b).subspan(from, n);
+        };
+        auto csub = [&](const BlockBuf &b) {
+          return std::span<const float>(b).subspan(from, n);
+        };
+        swarm.processBlock(csub(pitchBuf_), csub(swarmEnv), csub(morphEnv),
+                           sub(bufL_), sub(bufR_), hot_->swarmOsc,
+                           swarmChanged);
+        swarmChanged = false;
+      },
+      [&] { swarm.reset(); });
+}
 
-    swarm.tickStereo(cyclesPerSample_ * (1.f + p), sw, m, l, r);
+// FM over the pieces between triggers; operator envelopes restart at each
+template <class TR>
+void CalcisHumilis<TR>::render_(Voice &v, FM &fm) {
+  const auto &ver = hot_->versions;
+  bool fmChanged = ver.fm != v.seen.fm;
+  v.seen.fm = ver.fm;
+  splitAtTriggers_(
+      v.trig, v.from,
+      [&](int from, int n) {
+        fm.processBlock(std::span<const float>(pitchBuf_).subspan(from, n),
+                        std::span<float>(bufL_).subspan(from, n),
+                        std::span<float>(bufR_).subspan(from, n),
+                        hot_->fm, fmChanged);
+        fmChanged = false;
+      },
+      [&] { fm.reset(); });
+}
 
-    {
-      ZLKM_PERF_SCOPE_SAMPLED("filter", 6);
-      l = filterL.process(l, fCfg_);
-      r = filterR.process(r, fCfg_);
+// Construct the engine oscMode asks for unless it is the active one
+template <class TR>
+bool CalcisHumilis<TR>::selectEngine_(Voice &v) {
+  return v.engine.select(cold_->oscMode,
+                         [this](auto tag) -> const auto & {
+                           return engineCfg_(tag);
+                         });
+}
+
+// base plus the routes to 'dst', clamped, from frame 'from' on; base itself
+// when nothing routes there
+template <class TR>
+const typename CalcisHumilis<TR>::BlockBuf &CalcisHumilis<TR>::modulated_(
+    ModDest dst, const BlockBuf &base, float lo, float hi, int from) {
+  if (!matrix_.routed(dst)) return base;
+  BlockBuf &out = modBuf_[dst];
+  const std::span<float> o = std::span<float>(out).subspan(from);
+  std::copy(base.begin() + from, base.end(), o.begin());
+  matrix_.add(dst, envBuf_, from, o);
+  for (float &x : o) x = fminf(fmaxf(x, lo), hi);
+  return out;
+}
+
+// Cutoff routes are in octaves. The exact coefficient is computed at the end
+// of each kModChunk frames and the filter ramps to it, so the tan/exp2 cost
+// is per chunk rather than per sample. A voice starting mid-block ramps over
+// the rest of its first chunk.
+template <class TR>
+void CalcisHumilis<TR>::filterModulated_(Voice &v) {
+  const FilterCfg &tgt = hot_->filter;
+  const float base = atanf(tgt.gCut) * (1.f / math::PI_F);
+  const float gMax =
+      fminf(math::fast::tanPi<Tier::High>(kModCutMax),
+            audio::DJFilterLimitsDefault::kStabTau * tgt.kDamp);
+  std::span<float> l(bufL_), r(bufR_);
+  for (int c = v.from; c < OS_FRAMES;) {
+    const int end = (c / kModChunk + 1) * kModChunk;
+    const int n = end - c;
+    const float oct = matrix_.at(DestCutoff, envBuf_, end - 1);
+    const float x = fminf(fmaxf(base * math::fast::exp2(oct), kModCutMin),
+                          kModCutMax);
+    FilterCfg next = tgt;
+    next.gCut = fminf(math::fast::tanPi(x), gMax);
+    v.filterL.processBlock(l.subspan(c, n), l.subspan(c, n), v.fCfg, next);
+    v.filterR.processBlock(r.subspan(c, n), r.subspan(c, n), v.fCfg, next);
+    v.fCfg = next;
+    c = end;
+  }
+  v.seen.filter = hot_->versions.filter;
+  v.filterModded = true;
+}
+
+// Snap changed block-interpolated params to their targets; voices catch up
+// with the other sections when they start
+template <class TR>
+void CalcisHumilis<TR>::advanceSilent_() {
+  const auto &ver = hot_->versions;
+  if (ver.control != seen_.control) {
+    seen_.control = ver.control;
+    outGain_ = hot_->outGain;
+    pitch_ = cyclesToPitch(hot_->cyclesPerSample);
+  }
+}
+
+template <class TR>
+void CalcisHumilis<TR>::park_() {
+  decimL_.reset();
+  decimR_.reset();
+  parked_ = true;
+}
+
+template <class TR>
+typename CalcisHumilis<TR>::Triggers CalcisHumilis<TR>::collectTriggers_(
+    std::span<const audio::Event> events) {
+  Triggers tr;
+  if (hot_->trigCounter > trigCounter_) {
+    trigCounter_ = hot_->trigCounter;
+    trigPending_ = true;
+  }
+  if (trigPending_) {
+    trigPending_ = false;
+    tr.at[tr.count++] = 0;
+  }
+  for (const audio::Event &e : events) {
+    if (e.type != audio::Event::Trigger || tr.count == kMaxTriggers) continue;
+    const int f = std::min<int>(e.offset, TR::BLOCK_FRAMES - 1);
+    tr.at[tr.count++] = f * OS;
+  }
+  return tr;
+}
+
+template <class TR>
+void CalcisHumilis<TR>::publishTelemetry_(std::span<const float> l,
+                                          std::span<const float> r,
+                                          uint32_t t0Us) {
+  ZLKM_PERF_SCOPE("telemetry");
+  Telemetry t;
+  measure(l, r, t);
+  t.env = envLevels_;
+  t.renderUs = micros() - t0Us;
+  telemetry_->push(t);
+}
+
+template <class TR>
+void CalcisHumilis<TR>::measure(std::span<const float> l,
+                                std::span<const float> r, Telemetry &t) {
+  const std::span<const float> chans[2] = {l, r};
+  for (int c = 0; c < 2; ++c) {
+    float pk = 0.f, sumSq = 0.f;
+    for (const float x : chans[c]) {
+      pk = fmaxf(pk, fabsf(x));
+      sumSq += x * x;
+    }
+    t.peak[c] = pk;
+    if (!chans[c].empty()) {
+      t.rms[c] = math::fast::sqrt<Tier::High>(sumSq / float(chans[c].size()));
+    }
+  }
+  if (!l.empty()) {
+    const size_t stride = l.size() / SCOPE_POINTS;
+    for (int k = 0; k < SCOPE_POINTS; ++k) {
+      t.scope[k] = 0.5f * (l[k * stride] + r[k * stride]);
     }
+  }
+}
 
-    {
-      ZLKM_PERF_SCOPE_SAMPLED("clip", 6);
-      l = softClip(l * a * g);
-      r = softClip(r * a * g);
+// Triggers, config and every active voice into mixL_/mixR_. False when
+// parked: nothing rendered, the output is silence. 'idle': no voice was
+// active at the start, so the caller parks after using the block.
+template <class TR>
+bool CalcisHumilis<TR>::renderVoices_(std::span<const audio::Event> events,
+                                      bool &idle) {
+  const Triggers trig = collectTriggers_(events);
+  if (trig.count) parked_ = false;
+  if (cold_->version != seenCold_) {
+    seenCold_ = cold_->version;
+    // A new engine starts from a reset state at this block boundary
+    for (Voice &v : voices_) {
+      if (selectEngine_(v)) v.engine.visit([](auto &e) { e.reset(); });
     }
+    updateColdCfg_();
+  }
+  allocate_(trig);
+
+  idle = std::none_of(voices_.begin(), voices_.end(),
+                      [](const Voice &v) { return v.active; });
+  if (idle && parked_) {
+    ZLKM_PERF_SCOPE("silent");
+    advanceSilent_();
+    return false;
   }
 
-  if constexpr (TR::BITS == 24) {
-    // dstLR[2 * i + 0] = (int32_t)lrintf(outL * 8388607.0f) << 8;
-    // dstLR[2 * i + 1] = (int32_t)lrintf(outR * 8388607.0f) << 8;
-  } else if constexpr (TR::BITS == 32) {
-    ZLKM_PERF_SCOPE_SAMPLED("array_float_to_int32", 6);
-    array_float_to_int32(buffer, destLR);
+  control_();
+  mixL_.fill(0.f);
+  mixR_.fill(0.f);
+  for (Voice &v : voices_) {
+    if (v.active) renderVoice_(v);
   }
+  return true;
+}
+
+template <class TR>
+typename CalcisHumilis<TR>::Block CalcisHumilis<TR>::renderBlock(
+    std::span<const audio::Event> events) {
+  ZLKM_PERF_SCOPE("CalcisHumilis<TR>::renderBlock");
+  bool idle;
+  if (!renderVoices_(events, idle)) return {};
+  if (idle) park_();
+  return {mixL_, mixR_};
+}
+
+template <class TR>
+void CalcisHumilis<TR>::fillBlock(OutBuffer &destLR,
+                                  std::span<const audio::Event> events) {
+  ZLKM_PERF_SCOPE("CalcisHumilis<TR>::fillBlock");
+
+  const uint32_t t0Us = telemetry_ ? micros() : 0;
+  bool idle;
+  if (!renderVoices_(events, idle)) {
+    destLR.fill(0);
+    if (telemetry_) publishTelemetry_({}, {}, t0Us);
+    return;
+  }
+
+  using dsp::SoftClip;
+  using PcmOut = audio::Pcm<TR>;
+  if constexpr (OS == 1) {
+    // Clip and PCM conversion fused into one pass over the block
+    ZLKM_PERF_SCOPE("clip+pcm");
+    int clips = 0;
+    for (int i = 0; i < OS_FRAMES; ++i) {
+      mixL_[i] = SoftClip::process(mixL_[i], clips);
+      mixR_[i] = SoftClip::process(mixR_[i], clips);
+      PcmOut::putFrame(destLR, i, mixL_[i], mixR_[i]);
+    }
+    fb_->saturationCounter += clips;
+    if (telemetry_) publishTelemetry_(mixL_, mixR_, t0Us);
+  } else {
+    {
+      ZLKM_PERF_SCOPE("clip");
+      fb_->saturationCounter += SoftClip::processBlock(mixL_, mixL_);
+      fb_->saturationCounter += SoftClip::processBlock(mixR_, mixR_);
+    }
+    ZLKM_PERF_SCOPE("decimate+pcm");
+    const auto outL = decimL_.process(mixL_);
+    const auto outR = decimR_.process(mixR_);
+    PcmOut::write(outL, outR, destLR);
+    if (telemetry_) publishTelemetry_(outL, outR, t0Us);
+  }
+
+  if (idle) park_();
 }
 
-}  // namespace zlkm::ch
\ No newline at end of file
+}  // namespace zlkm::ch
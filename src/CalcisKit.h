@@ -0,0 +1,312 @@
+#pragma once
+
+#include <math.h>
+
+#include <array>
+#include <span>
+#include <utility>
+
+#include "CalcisHumilis.h"
+#include "audio/Event.h"
+#include "audio/Pcm.h"
+#include "dsp/Decimator.h"
+#include "dsp/SoftClip.h"
+#include "math/Constants.h"
+#include "platform/platform.h"
+#include "util/Profiler.h"
+
+namespace zlkm::ch {
+
+// N independently configured CalcisHumilis instruments (kick, snare, hat,
+// ...) mixed into one stereo block; drops into AudioCore in place of a
+// single instance.
+//
+// Instruments render one after another through the scratch buffers they
+// share, and a parked one costs only its silent path. Each has a gain and
+// an equal-power pan, ramped across a block when they change, and a choke
+// group: a hit fades out the other instruments of its group (a closed hat
+// cutting the open one). Instruments hand over their internal-rate mix; the
+// sum is clipped there, oversampled, and decimated once.
+template <class TR, int N>
+class CalcisKit {
+  static_assert(N >= 1);
+  static constexpr int OS = TR::OS;
+  static constexpr int FRAMES = CalcisHumilis<TR>::INTERNAL_FRAMES;
+  using BlockBuf = std::array<float, FRAMES>;
+
+ public:
+  using Inst = CalcisHumilis<TR>;
+  using InstCfg = typename Inst::Cfg;
+  using Feedback = typename Inst::Feedback;
+  using Telemetry = typename Inst::Telemetry;
+  using TelemetryRing = typename Inst::TelemetryRing;
+
+  static constexpr int size() { return N; }
+  static constexpr int kChokeGroups = 4;  // group 0: none
+
+  // Inst::Cfg's hot/cold split with one entry per instrument, so each
+  // section still crosses cores through its own queue. Gain, pan and choke
+  // are read every block and have no version.
+  struct Cfg {
+    struct Hot {
+      std::array<typename InstCfg::Hot, N> inst;
+      std::array<float, N> gain = filled_(.8f);  // 0..1
+      std::array<float, N> pan = filled_(.5f);   // 0: left .. 1: right
+
+      void bumpAll() {
+        for (auto& h : inst) h.bumpAll();
+      }
+      uint32_t* sectionVersion(const void* field) {
+        for (auto& h : inst) {
+          if (uint32_t* v = h.sectionVersion(field)) return v;
+        }
+        return nullptr;
+      }
+    };
+
+    struct Cold {
+      std::array<typename InstCfg::Cold, N> inst;
+      std::array<uint8_t, N> choke{};  // 0..kChokeGroups-1
+
+      void bumpAll() {
+        for (auto& c : inst) ++c.version;
+      }
+      uint32_t* sectionVersion(const void* field) {
+        for (auto& c : inst) {
+          if (uint32_t* v = c.sectionVersion(field)) return v;
+        }
+        return nullptr;
+      }
+    };
+
+    Hot hot;
+    Cold cold;
+
+    // Kick, snare and hat; instruments past the third start as kicks
+    Cfg() {
+      if constexpr (N > 1) snare_(1);
+      if constexpr (N > 2) hat_(2);
+    }
+
+    void bumpAll() {
+      hot.bumpAll();
+      cold.bumpAll();
+    }
+
+    uint32_t* sectionVersion(const void* field) {
+      if (uint32_t* v = cold.sectionVersion(field)) return v;
+      return hot.sectionVersion(field);
+    }
+
+   private:
+    static constexpr std::array<float, N> filled_(float v) {
+      std::array<float, N> a{};
+      for (float& x : a) x = v;
+      return a;
+    }
+
+    void snare_(int i) {
+      auto& h = hot.inst[i];
+      auto& c = cold.inst[i];
+      h.cyclesPerSample = Inst::cycles(185.f);
+      h.swarmOsc.voices = Inst::MAX_SWARM_VOICES;
+      h.swarmOsc.morph = .9f;
+      c.envs[Inst::EnvAmp] = {Inst::rate(1.f), Inst::rate(180.f)};
+      c.envs[Inst::EnvPitch] = {Inst::rate(1.f), Inst::rate(30.f), 12.f};
+      hot.gain[i] = .7f;
+      hot.pan[i] = .45f;
+    }
+
+    void hat_(int i) {
+      auto& h = hot.inst[i];
+      auto& c = cold.inst[i];
+      h.cyclesPerSample = Inst::cycles(410.f);
+      h.fm.algorithm = 2;  // three modulators into one carrier
+      h.fm.level = {1.f, .9f, .8f, .7f};
+      h.fm.feedback = .6f;
+      c.oscMode = Inst::OscFM;
+      c.envs[Inst::EnvAmp] = {Inst::rate(.5f), Inst::rate(70.f)};
+      c.envs[Inst::EnvPitch].depth = 0.f;
+      for (auto& e : c.fmEnvs) e = {Inst::rate(.5f), Inst::rate(90.f)};
+      hot.gain[i] = .5f;
+      hot.pan[i] = .6f;
+    }
+  };
+
+  CalcisKit(const Cfg* cfg, Feedback* fb, TelemetryRing* telemetry = nullptr)
+      : cfg_(cfg),
+        fb_(fb),
+        telemetry_(telemetry),
+        inst_(make_(cfg, fb, std::make_index_sequence<N>{})) {
+    seenGain_.fill(-1.f);
+    for (int i = 0; i < N; ++i) {
+      seenTrig_[i] = cfg->hot.inst[i].trigCounter;
+      targets_(i, gainL_[i], gainR_[i]);
+    }
+  }
+
+  // Interleaved stereo block, as CalcisHumilis::fillBlock(). Each event
+  // goes to the instrument in its 'target'.
+  void fillBlock(typename TR::BufferT& destLR,
+                 std::span<const audio::Event> events = {}) {
+    ZLKM_PERF_SCOPE("CalcisKit::fillBlock");
+    const uint32_t t0Us = telemetry_ ? micros() : 0;
+
+    // Split the events and queue chokes before anything renders
+    std::array<std::array<audio::Event, kMaxEvents>, N> ev;
+    std::array<size_t, N> nEv{};
+    for (const audio::Event& e : events) {
+      if (e.target >= N || nEv[e.target] == kMaxEvents) continue;
+      ev[e.target][nEv[e.target]++] = e;
+      if (e.type == audio::Event::Trigger) hit_(e.target, e.offset);
+    }
+    for (int i = 0; i < N; ++i) {
+      const int tc = cfg_->hot.inst[i].trigCounter;
+      if (tc > seenTrig_[i]) {
+        seenTrig_[i] = tc;
+        hit_(i, 0);
+      }
+    }
+
+    bool any = false;
+    for (int i = 0; i < N; ++i) {
+      const auto b = inst_[i].renderBlock({ev[i].data(), nEv[i]});
+      float tl, tr;
+      targets_(i, tl, tr);
+      if (b.l.empty()) {
+        gainL_[i] = tl;
+        gainR_[i] = tr;
+        continue;
+      }
+      if (!any) {
+        mixL_.fill(0.f);
+        mixR_.fill(0.f);
+        any = true;
+      }
+      mix_(b, i, tl, tr);
+    }
+
+    if (!any) {
+      // Flushed decimators, as in CalcisHumilis' parked state
+      if (!parked_) {
+        decimL_.reset();
+        decimR_.reset();
+        parked_ = true;
+      }
+      destLR.fill(0);
+      if (telemetry_) publish_({}, {}, t0Us);
+      return;
+    }
+    parked_ = false;
+
+    using dsp::SoftClip;
+    using PcmOut = audio::Pcm<TR>;
+    if constexpr (OS == 1) {
+      ZLKM_PERF_SCOPE("clip+pcm");
+      int clips = 0;
+      for (int i = 0; i < FRAMES; ++i) {
+        mixL_[i] = SoftClip::process(mixL_[i], clips);
+        mixR_[i] = SoftClip::process(mixR_[i], clips);
+        PcmOut::putFrame(destLR, i, mixL_[i], mixR_[i]);
+      }
+      fb_->saturationCounter += clips;
+      if (telemetry_) publish_(mixL_, mixR_, t0Us);
+    } else {
+      {
+        ZLKM_PERF_SCOPE("clip");
+        fb_->saturationCounter += SoftClip::processBlock(mixL_, mixL_);
+        fb_->saturationCounter += SoftClip::processBlock(mixR_, mixR_);
+      }
+      ZLKM_PERF_SCOPE("decimate+pcm");
+      const auto outL = decimL_.process(mixL_);
+      const auto outR = decimR_.process(mixR_);
+      PcmOut::write(outL, outR, destLR);
+      if (telemetry_) publish_(outL, outR, t0Us);
+    }
+  }
+
+ private:
+  static constexpr int kMaxEvents = 8;  // per instrument and block
+
+  template <size_t... I>
+  static std::array<Inst, N> make_(const Cfg* cfg, Feedback* fb,
+                                   std::index_sequence<I...>) {
+    return {Inst(&cfg->hot.inst[I], &cfg->cold.inst[I], fb)...};
+  }
+
+  // Instrument i hits at 'offset': it becomes the one telemetry follows
+  // and the rest of its choke group fades out
+  void hit_(int i, int offset) {
+    last_ = i;
+    const uint8_t g = cfg_->cold.choke[i];
+    if (!g) return;
+    for (int j = 0; j < N; ++j) {
+      if (j != i && cfg_->cold.choke[j] == g) inst_[j].choke(offset);
+    }
+  }
+
+  // Left/right gains of instrument i: equal-power pan, centre at -3 dB.
+  // The pan law only reruns after an edit.
+  void targets_(int i, float& l, float& r) {
+    const float g = cfg_->hot.gain[i], p = cfg_->hot.pan[i];
+    if (g != seenGain_[i] || p != seenPan_[i]) {
+      seenGain_[i] = g;
+      seenPan_[i] = p;
+      const float a = p * (.5f * math::PI_F);
+      tgtL_[i] = g * cosf(a);
+      tgtR_[i] = g * sinf(a);
+    }
+    l = tgtL_[i];
+    r = tgtR_[i];
+  }
+
+  // Add instrument i's block, ramping from the last gains to tl/tr
+  void mix_(const typename Inst::Block& b, int i, float tl, float tr) {
+    ZLKM_PERF_SCOPE("mix");
+    float gl = gainL_[i], gr = gainR_[i];
+    if (gl == tl && gr == tr) {
+      for (int f = 0; f < FRAMES; ++f) {
+        mixL_[f] += b.l[f] * gl;
+        mixR_[f] += b.r[f] * gr;
+      }
+      return;
+    }
+    const float dl = (tl - gl) * (1.f / float(FRAMES));
+    const float dr = (tr - gr) * (1.f / float(FRAMES));
+    for (int f = 0; f < FRAMES; ++f) {
+      gl += dl;
+      gr += dr;
+      mixL_[f] += b.l[f] * gl;
+      mixR_[f] += b.r[f] * gr;
+    }
+    gainL_[i] = tl;
+    gainR_[i] = tr;
+  }
+
+  void publish_(std::span<const float> l, std::span<const float> r,
+                uint32_t t0Us) {
+    ZLKM_PERF_SCOPE("telemetry");
+    Telemetry t;
+    Inst::measure(l, r, t);
+    t.env = inst_[last_].envLevels();
+    t.renderUs = micros() - t0Us;
+    telemetry_->push(t);
+  }
+
+  const Cfg* cfg_;
+  Feedback* fb_;
+  TelemetryRing* telemetry_;
+
+  std::array<Inst, N> inst_;
+  std::array<int, N> seenTrig_{};
+  std::array<float, N> gainL_{}, gainR_{};  // as of the last block
+  std::array<float, N> tgtL_{}, tgtR_{};
+  std::array<float, N> seenGain_{}, seenPan_{};  // tgtL_/tgtR_ are for these
+  int last_ = 0;                                 // most recently hit
+
+  BlockBuf mixL_{}, mixR_{};  // internal rate
+  dsp::Decimator<OS, FRAMES> decimL_, decimR_;
+  bool parked_ = false;  // every instrument parked, decimators flushed
+};
+
+}  // namespace zlkm::ch
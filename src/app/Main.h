@@ -1,16 +1,19 @@
 #pragma once
+#include <array>
 #include <atomic>
 
 #include "platform/platform.h"
 #include "util/Profiler.h"
-#include "util/spin_lock.h"
+#include "util/Scheduler.h"
+#include "util/TripleBuffer.h"
 
 namespace zlkm::app {
 /**
  * Dual-core harness for RP2350 (Pico 2).
  *
  * Core 1: AudioSource (tight loop; treat as higher priority)
- * Core 0: UI (yields/sleeps; lower impact)
+ * Core 0: UI tasks from a static table (input, cfg sync, view, profiler),
+ *         sleeping only until the next one is due
  */
 template <class AudioSource, class UI>
 class MainApp {
@@ -31,10 +34,8 @@ class MainApp {
   }
 
   static void ui_loop() {
-    get().snapUIFeedback();
-    get().ui_.update();
-    get().publishAudioCfg();
-    sleep_ms(2);
+    const uint32_t waitUs = get().sched_.runOnce();
+    if (waitUs) sleep_us(waitUs);
   }
 
   static void audio_start() {
@@ -59,28 +60,61 @@ class MainApp {
     }
   }
 
+  // Config: core 0 -> core 1. The UI queues only the fields it edits; the
+  // audio side applies them between blocks and never waits. A copy of a
+  // whole Cfg section happens only when that section's queue overflowed.
   void snapAudioCfg() {
     ZLKM_PERF_SCOPE("MainApp::snapAudioCfg");
-    util::sl_guard guard{cfgSL_};
-    audioCfg_ = sharedCfg_;
+    paramQ_.apply(audioCfg_);
   }
 
   void publishAudioCfg() {
     ZLKM_PERF_SCOPE("MainApp::publishAudioCfg");
-    util::sl_guard guard{cfgSL_};
-    sharedCfg_ = uiAudioCfg_;
+    paramQ_.flush(uiAudioCfg_);
   }
 
+  // Feedback: core 1 -> core 0, same scheme in the other direction
   void publishUIFeedback() {
     ZLKM_PERF_SCOPE("MainApp::publishUIFeedback");
-    util::sl_guard guard{fbSL_};
-    sharedFb_ = audioUiFb_;
+    fbTB_.back() = audioUiFb_;
+    fbTB_.publish();
   }
 
   void snapUIFeedback() {
     ZLKM_PERF_SCOPE("MainApp::snapUIFeedback");
-    util::sl_guard guard{fbSL_};
-    uiFb_ = sharedFb_;
+    if (fbTB_.update()) uiFb_ = fbTB_.front();
+  }
+
+  // ---- core 0 tasks ----
+  void pollInput_() { ui_.pollInput(); }
+
+  void syncCfg_() {
+    snapUIFeedback();
+    publishAudioCfg();
+  }
+
+  void render_() { ui_.render(); }
+
+  void profilerTick_() { ZLKM_PROFILE_TICK(); }
+
+  // Report tasks that missed a deadline or budget since the last report
+  void logSchedStats_() {
+    for (size_t i = 0; i < Sched::size(); ++i) {
+      const auto& s = sched_.stats(i);
+      const uint32_t misses = s.late + s.overBudget + s.skipped;
+      if (misses == reportedMisses_[i]) continue;
+      reportedMisses_[i] = misses;
+      Log.warning(F("[Sched] %s: runs=%u late=%u over=%u skipped=%u "
+                    "maxRun=%uus maxLatency=%uus" CR),
+                  sched_.task(i).name, unsigned(s.runs), unsigned(s.late),
+                  unsigned(s.overBudget), unsigned(s.skipped),
+                  unsigned(s.maxRunUs), unsigned(s.maxLatencyUs));
+    }
+  }
+
+  template <void (MainApp::*M)()>
+  static void call_(void* self) {
+    (static_cast<MainApp*>(self)->*M)();
   }
 
   static MainApp& get() {
@@ -92,19 +126,37 @@ class MainApp {
 
   using Cfg = typename AudioSource::Cfg;
   using Feedback = typename AudioSource::Feedback;
+  using TelemetryRing = typename AudioSource::TelemetryRing;
 
-  util::spin_lock cfgSL_;
-  Cfg sharedCfg_{};
+  typename UI::Params paramQ_;  // the UI's edit protocol
   Cfg audioCfg_{};
   Cfg uiAudioCfg_{};
 
-  util::spin_lock fbSL_;
-  Feedback sharedFb_{};
+  util::TripleBuffer<Feedback> fbTB_;
   Feedback audioUiFb_{};
   Feedback uiFb_{};
 
-  UI ui_{&uiAudioCfg_, &uiFb_};
-  AudioSource audio_{&audioCfg_, &audioUiFb_};
+  // Per-block meters/scope, core 1 -> core 0; lock-free, lossy when full
+  TelemetryRing telemetry_;
+
+  UI ui_{&uiAudioCfg_, &uiFb_, &paramQ_, &telemetry_};
+  AudioSource audio_{&audioCfg_, &audioUiFb_, &telemetry_};
+
+  // Cfg goes out once per audio block: the audio side cannot use it sooner
+  using TR = typename AudioSource::TR;
+  static constexpr uint32_t kBlockUs =
+      uint32_t(uint64_t(TR::BLOCK_FRAMES) * 1000000u / TR::SR);
+
+  // name, fn, ctx, period, deadline (0: period), budget (0: unchecked)
+  using Sched = util::Scheduler<5>;
+  Sched sched_{{{
+      {"input", &call_<&MainApp::pollInput_>, this, 1000, 0, 300},
+      {"cfg", &call_<&MainApp::syncCfg_>, this, kBlockUs, 0, 200},
+      {"view", &call_<&MainApp::render_>, this, ui_.frameUs(), 0, 0},
+      {"profiler", &call_<&MainApp::profilerTick_>, this, 100000, 0, 0},
+      {"stats", &call_<&MainApp::logSchedStats_>, this, 5000000, 0, 0},
+  }}};
+  std::array<uint32_t, Sched::size()> reportedMisses_{};
 
   static inline std::atomic<bool> c0Started_ = {false};
   static inline std::atomic<bool> c1Started_ = {false};
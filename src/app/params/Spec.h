@@ -0,0 +1,173 @@
+#pragma once
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+
+#include "audio/DJFilter.h"
+#include "dsp/Util.h"
+#include "math/Util.h"
+
+namespace zlkm::app::params {
+
+// How the normalized 0..1 control spreads over [min, max]
+enum class Curve : uint8_t {
+  Linear,  // min + x * (max - min)
+  Power,   // min + x^shape * (max - min)
+  Octave,  // min * (max / min)^(x^shape): equal steps in log2
+  Step,    // Linear, rounded to whole numbers
+};
+
+// One parameter: its user-facing domain and the mapping from 0..1. The
+// stored form (cycles, rates, coefficients) is a separate Store step so the
+// UI and the DSP config agree on what a knob position means.
+struct Spec {
+  const char* name;
+  const char* unit;
+  float min;
+  float max;
+  Curve curve = Curve::Linear;
+  float shape = 1.f;
+
+  float toDomain(float x) const {
+    x = math::clamp01(x);
+    switch (curve) {
+      case Curve::Power:
+        return min + powf(x, shape) * (max - min);
+      case Curve::Octave:
+        return min * powf(max / min, shape == 1.f ? x : powf(x, shape));
+      case Curve::Step:
+        return roundf(min + x * (max - min));
+      case Curve::Linear:
+      default:
+        return min + x * (max - min);
+    }
+  }
+
+  float fromDomain(float v) const {
+    if (max == min) return 0.f;
+    float x;
+    switch (curve) {
+      case Curve::Power:
+        x = powf(math::clamp01((v - min) / (max - min)), 1.f / shape);
+        break;
+      case Curve::Octave:
+        x = logf(fmaxf(v, min) / min) / logf(max / min);
+        if (shape != 1.f) x = powf(math::clamp01(x), 1.f / shape);
+        break;
+      case Curve::Linear:
+      case Curve::Step:
+      default:
+        x = (v - min) / (max - min);
+        break;
+    }
+    return math::clamp01(x);
+  }
+};
+
+// toDomain() sampled at N points and interpolated, for curves that would
+// otherwise cost a powf per knob tick. Built once, on the UI core.
+template <size_t N = 65>
+class Table {
+  static_assert(N >= 2);
+
+ public:
+  explicit Table(const Spec& s) {
+    for (size_t i = 0; i < N; ++i) {
+      v_[i] = s.toDomain(float(i) / float(N - 1));
+    }
+  }
+
+  float operator()(float x) const {
+    const float f = math::clamp01(x) * float(N - 1);
+    const size_t i = f < float(N - 1) ? size_t(f) : N - 2;
+    return v_[i] + (f - float(i)) * (v_[i + 1] - v_[i]);
+  }
+
+ private:
+  std::array<float, N> v_;
+};
+
+// Domain value -> what the config field holds
+struct AsIs {
+  static float store(float v) { return v; }
+  static float load(float s) { return s; }
+};
+
+// Hz -> cycles per sample
+template <int SR>
+struct Cycles {
+  static float store(float hz) { return hz * (1.f / float(SR)); }
+  static float load(float c) { return c * float(SR); }
+};
+
+// ms -> envelope rate per sample
+template <int SR>
+struct Rate {
+  static float store(float ms) { return dsp::msToRate(ms, float(SR)); }
+  static float load(float r) { return dsp::rateToMs(r, float(SR)); }
+};
+
+enum Id : uint8_t {
+  Pitch = 0,
+  Volume,
+  AmpAttack,
+  AmpDecay,
+  AmpDepth,
+  PitchDecay,
+  PulseWidth,
+  Morph,
+  Detune,
+  Spread,
+  Voices,
+  MorphMode,
+  RandomPhase,
+  EngineSel,
+  FilterCutoff,
+  FilterRes,
+  FilterDrive,
+  FilterMorph,
+  Instrument,
+  MixGain,
+  MixPan,
+  Choke,
+  IdCount
+};
+
+// Parameter table of an engine (voice and engine counts come from it). The
+// filter entries describe SafeFilterParams' inputs: it keeps cutoff and Q
+// inside the stability limits, so they are nominal ranges. INSTRUMENTS and
+// CHOKE_GROUPS size the kit entries when the engine runs in a kit.
+template <class Engine, class FLim = audio::DJFilterLimitsDefault,
+          int INSTRUMENTS = 1, int CHOKE_GROUPS = 1>
+struct Registry {
+  static constexpr std::array<Spec, IdCount> kSpecs = {{
+      {"pitch", "Hz", 65.f, 260.f},
+      {"volume", "", 0.f, 1.f},
+      {"amp.attack", "ms", 1.f, 1000.f},
+      {"amp.decay", "ms", 20.f, 2000.f},
+      {"amp.depth", "", 0.f, 1.f},
+      {"pitch.decay", "ms", 2.f, 80.f},
+      {"swarm.pw", "", .01f, .99f},
+      {"swarm.morph", "", 0.f, 1.f},
+      {"swarm.detune", "x", 1.f, 1.05946f},
+      {"swarm.spread", "", 0.f, 1.f},
+      {"swarm.voices", "", 1.f, float(Engine::MAX_SWARM_VOICES), Curve::Step},
+      {"swarm.morphMode", "", 0.f, 2.f, Curve::Step},
+      {"swarm.randomPhase", "", 0.f, 1.f, Curve::Step},
+      {"engine", "", 0.f, float(Engine::OscCount - 1), Curve::Step},
+      {"filter.cutoff", "Hz", FLim::kMinHz, FLim::kHardTopHz},
+      {"filter.q", "", FLim::kQmin, FLim::kQmax, Curve::Octave, FLim::kCurve},
+      {"filter.drive", "x", 1.f, FLim::kDriveMax},
+      {"filter.morph", "", 0.f, 1.f},
+      {"kit.instrument", "", 0.f, float(INSTRUMENTS - 1), Curve::Step},
+      {"kit.gain", "", 0.f, 1.f},
+      {"kit.pan", "", 0.f, 1.f},
+      {"kit.choke", "", 0.f, float(CHOKE_GROUPS - 1), Curve::Step},
+  }};
+
+  static constexpr const Spec& get(Id id) { return kSpecs[id]; }
+};
+
+}  // namespace zlkm::app::params
@@ -1,90 +1,73 @@
 #pragma once
-#include <AudioTools.h>
+#include <ArduinoLog.h>
 
 #include "AudioTraits.h"
-#include "platform/boards/Current.h"
+#include "platform/platform.h"
+
+#if defined(ARDUINO)
+#include "audio/sink/I2SSink.h"
+#else
+#include "audio/sink/ClockedSink.h"
+#endif
 
 namespace zlkm::audio {
 
-template <class TR_, template <class> class AppT>
+// The board's DAC on device, a DAC clocked by micros() on the host
+#if defined(ARDUINO)
+template <class TR, int DEPTH>
+using DefaultSink = I2SSink<TR, DEPTH>;
+#else
+template <class TR, int DEPTH>
+using DefaultSink = ClockedSink<TR, DEPTH>;
+#endif
+
+// Runs the app against an output sink. The sink pulls: update() hands it
+// the render callback and it fills a block only when the device has room
+// for one, so between blocks core 1 does no audio work at all.
+//
+// DEPTH is how many blocks the device queues ahead: each one adds a block
+// of latency and lets a single render run that much longer than a block
+// without an audible gap. The I2S sink adds the two blocks its DMA holds.
+template <class TR_, template <class> class AppT, int DEPTH = 2,
+          template <class, int> class SinkT = DefaultSink>
 class AudioCore {
+  static_assert(DEPTH >= 2 && DEPTH <= 8, "DEPTH must be 2..8 blocks");
+
  public:
   using TR = TR_;
   using App = AppT<TR>;
+  using Sink = SinkT<TR, DEPTH>;
   using Cfg = typename App::Cfg;
-  using CurBoard = zlkm::platform::boards::Current;
-  using SrcPinId = typename CurBoard::SrcPinId;
   using Feedback = typename App::Feedback;
+  using TelemetryRing = typename App::TelemetryRing;
 
-  int getPin(SrcPinId pin) { return zlkm::hw::io::getPin(pin).value; }
-
-  AudioCore(Cfg* cfg, Feedback* fb) : app_(cfg, fb) {
-    // TODO: move device out of the core
-    auto icfg = i2sOut_.defaultConfig(TX_MODE);
-    icfg.sample_rate = TR::SR;                   // 96 kHz
-    icfg.channels = 2;                           // stereo
-    icfg.bits_per_sample = 32;                   // 32-bit words
-    icfg.pin_bck = getPin(CurBoard::PIN_BCK);    // PCM510X BCK
-    icfg.pin_ws = getPin(CurBoard::PIN_LRCK);    // PCM510X LRCK
-    icfg.pin_data = getPin(CurBoard::PIN_DATA);  // PCM510X DIN
-    Log.notice(F("[I2S] BCK=%d WS=%d DATA=%d, %d Hz, %d-bit, ch=%d" CR),
-               icfg.pin_bck, icfg.pin_ws, icfg.pin_data, icfg.sample_rate,
-               icfg.bits_per_sample, icfg.channels);
-    bool ok = i2sOut_.begin(icfg);
-    if (!ok) {
-      Log.error(
-          F("[I2S] begin() failed; check pins, adjacency, and wiring" CR));
-    }
-
+  AudioCore(const Cfg* cfg, Feedback* fb, TelemetryRing* telemetry = nullptr)
+      : app_(cfg, fb, telemetry), fb_(fb) {
     // Prime audio
-    queueNextBlockIfNeeded_();
+    update();
 
-    Log.notice(F("[Audio] %d Hz, 32-bit, block=%u" CR), TR::SR,
-               (unsigned)TR::BLOCK_FRAMES);
-    inited_ = true;
+    Log.notice(F("[Audio] %d Hz, %d-bit, block=%u, depth=%d" CR), TR::SR,
+               TR::BITS, (unsigned)TR::BLOCK_FRAMES, DEPTH);
   }
+
   // Called in a tight loop by MainApp on core 1
   void update() {
-    // keep I2S fed (non-blocking; double-buffered)
-    queueNextBlockIfNeeded_();
+    sink_.service(micros(), [this](OutBuffer& buf) { app_.fillBlock(buf); });
+    fb_->underruns = sink_.underruns();
+    fb_->nearMisses = sink_.nearMisses();
     // Lightweight pacing hint for SDK; no sleeps in audio path
     tight_loop_contents();
   }
 
- private:
-  // ---- audio write helper (non-blocking) ----
-  void queueNextBlockIfNeeded_() {
-    if (bytesLeft_ == 0) {
-      OutBuffer& buf = (whichBuf_ == 0) ? audioBufA_ : audioBufB_;
-      whichBuf_ ^= 1;
-      app_.fillBlock(buf);
-
-      writePtr_ = reinterpret_cast<uint8_t*>(buf.data());
-      bytesLeft_ = TR::BLOCK_BYTES;
-    }
-    if (bytesLeft_) {
-      size_t wrote = i2sOut_.write(writePtr_, bytesLeft_);
-      writePtr_ += wrote;
-      bytesLeft_ -= wrote;
-    }
-  }
+  // When the queued audio runs out
+  uint32_t deadlineUs() const { return sink_.deadlineUs(); }
 
+ private:
   using OutBuffer = typename TR::BufferT;
 
-  // double-buffering
-  alignas(8) OutBuffer audioBufA_;
-  alignas(8) OutBuffer audioBufB_;
-
-  I2SStream i2sOut_;
+  Sink sink_;  // device first: it is up before the first block is pulled
   App app_;
-  bool inited_ = false;
-
-  int whichBuf_ = 0;
-  uint8_t* writePtr_ = nullptr;
-  size_t bytesLeft_ = 0;
-
-  // trigger edge tracking
-  uint32_t lastTrigCounter_ = 0;
+  Feedback* fb_;
 };
 
-}  // namespace zlkm::audio
\ No newline at end of file
+}  // namespace zlkm::audio
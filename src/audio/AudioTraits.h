@@ -1,6 +1,10 @@
 #pragma once
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include <array>
+#include <type_traits>
 
 namespace zlkm::audio {
 
@@ -22,20 +26,30 @@ struct BitTraitsImpl<32> {
   using SampleT = int32_t;
 };
 
-template <int SR_, int OS_, int BITS_, int BLOCK_FRAMES_, bool STEREO_ = true>
+// PACK24: 24-bit samples as 3 packed bytes instead of 24-in-32, so the
+// block (and I2S bandwidth) shrinks by a quarter
+template <int SR_, int OS_, int BITS_, int BLOCK_FRAMES_, bool STEREO_ = true,
+          bool PACK24_ = false>
 struct AudioTraits {
+  static_assert(!PACK24_ || BITS_ == 24, "PACK24 needs BITS == 24");
   using IMPL = BitTraitsImpl<BITS_>;
   using SampleT = typename IMPL::SampleT;
 
   static constexpr bool STEREO = STEREO_;
+  static constexpr bool PACK24 = PACK24_;
   static constexpr int BITS = BITS_;
   static constexpr int BLOCK_FRAMES = BLOCK_FRAMES_;
   static constexpr int SR = SR_;
   static constexpr int OS = OS_;
-  static constexpr size_t BLOCK_BYTES = BLOCK_FRAMES * 2 * sizeof(SampleT);
   static constexpr int BLOCK_ELEMS = STEREO ? BLOCK_FRAMES * 2 : BLOCK_FRAMES;
-
-  using BufferT = std::array<SampleT, BLOCK_ELEMS>;
+  // Bytes per sample on the wire and I2S slot width
+  static constexpr int SAMPLE_BYTES = PACK24 ? 3 : int(sizeof(SampleT));
+  static constexpr int I2S_BITS = SAMPLE_BYTES * 8;
+  static constexpr size_t BLOCK_BYTES = size_t(BLOCK_ELEMS) * SAMPLE_BYTES;
+
+  using BufferT =
+      std::conditional_t<PACK24, std::array<uint8_t, BLOCK_BYTES>,
+                         std::array<SampleT, BLOCK_ELEMS>>;
 };
 
 }  // namespace zlkm
\ No newline at end of file
@@ -2,7 +2,11 @@
 
 #include <assert.h>
 
+#include <array>
+#include <span>
+
 #include "dsp/Util.h"
+#include "math/Fast.h"
 #include "math/Constants.h"
 #include "math/Util.h"
 #include "platform/platform.h"
@@ -34,7 +38,7 @@ class DJFilterTPT {
  public:
   struct Cfg {
     float gCut = dsp::hzToGCut<SR>(DJFilterLimitsDefault::kHardTopHz);
-    float kDamp = dsp::res01ToKDamp_smooth(0.f);
+    float kDamp = 2.f / DJFilterLimitsDefault::kQmin;  // k = 2/Q
     float lpWeight = 1.f;  // low-pass contribution (Q-compensated)
     float hpWeight = 0.f;  // high-pass contribution
     float drive = 1.f;
@@ -57,16 +61,58 @@ class DJFilterTPT {
   // morph: 0..1 (0=LP -> 1=HP), pre-shaped/limited outside
   // drive: post-filter gain before soft clip, pre-limited outside
   inline float process(float sample, Cfg const& cfg) {
-    // TPT SVF core (no guards)
-    const float a1 = 1.0f / (1.0f + cfg.gCut * (cfg.gCut + cfg.kDamp));
+    return tick_(sample, cfg, a1_(cfg), ic1eq_, ic2eq_);
+  }
+
+  // Block form with constant cfg: the SVF reciprocal is computed once
+  inline void processBlock(std::span<const float> in, std::span<float> out,
+                           Cfg const& cfg) {
+    const float a1 = a1_(cfg);
+    float s1 = ic1eq_, s2 = ic2eq_;
+    for (size_t i = 0; i < out.size(); ++i) {
+      out[i] = tick_(in[i], cfg, a1, s1, s2);
+    }
+    ic1eq_ = s1;
+    ic2eq_ = s2;
+  }
 
-    const float v1 = (sample - ic2eq_ - cfg.kDamp * ic1eq_) * a1;  // hp proto
-    const float v2 = cfg.gCut * v1 + ic1eq_;                       // bp
-    const float v3 = cfg.gCut * v2 + ic2eq_;                       // lp
+  // Block form of process(): cfg ramps linearly from 'from' to 'to' across
+  // the block (first sample already one step in, as with BlockInterpolator).
+  // 'in' and 'out' may alias.
+  inline void processBlock(std::span<const float> in, std::span<float> out,
+                           Cfg const& from, Cfg const& to) {
+    const size_t n = out.size();
+    const float inv = 1.f / float(n);
+    Cfg c = from;
+    float* p = &c.gCut;
+    const auto& t = to.asTarget();
+    std::array<float, Cfg::PCOUNT> d;
+    for (int k = 0; k < Cfg::PCOUNT; ++k) d[k] = (t[k] - p[k]) * inv;
+
+    float s1 = ic1eq_, s2 = ic2eq_;
+    for (size_t i = 0; i < n; ++i) {
+      for (int k = 0; k < Cfg::PCOUNT; ++k) p[k] += d[k];
+      out[i] = tick_(in[i], c, a1_(c), s1, s2);
+    }
+    ic1eq_ = s1;
+    ic2eq_ = s2;
+  }
+
+ private:
+  static inline float a1_(Cfg const& cfg) {
+    return 1.0f / (1.0f + cfg.gCut * (cfg.gCut + cfg.kDamp));
+  }
+
+  static inline float tick_(float sample, Cfg const& cfg, float a1,
+                            float& ic1eq, float& ic2eq) {
+    // TPT SVF core (no guards)
+    const float v1 = (sample - ic2eq - cfg.kDamp * ic1eq) * a1;  // hp proto
+    const float v2 = cfg.gCut * v1 + ic1eq;                      // bp
+    const float v3 = cfg.gCut * v2 + ic2eq;                      // lp
 
     static constexpr float kLeakMul = 1.0f - (1.0f / (SR * 60.0f));
-    ic1eq_ = (2.0f * v2 - ic1eq_) * kLeakMul;
-    ic2eq_ = (2.0f * v3 - ic2eq_) * kLeakMul;
+    ic1eq = (2.0f * v2 - ic1eq) * kLeakMul;
+    ic2eq = (2.0f * v3 - ic2eq) * kLeakMul;
 
     float y = cfg.lpWeight * v3 + cfg.hpWeight * v1;
 
@@ -76,7 +122,6 @@ class DJFilterTPT {
     return y / (1.0f + fabsf(y));
   }
 
- private:
   float ic1eq_ = 0.0f;  // "integrator capacitor" 1 (≈ band state)
   float ic2eq_ = 0.0f;  // "integrator capacitor" 2 (≈ low state)
 };
@@ -135,7 +180,7 @@ class SafeFilterParams {
     float Q = clampf(Qt, Limits::kQmin, Limits::kQmax);
 
     // Derived audio scalars
-    cfg_->gCut = tanf(float(zlkm::math::PI_F) * cutoffHz / kSR);
+    cfg_->gCut = math::fast::tanPi<math::fast::Tier::High>(cutoffHz / kSR);
     cfg_->kDamp = 2.f / Q;
 
     const float Qnorm = (Q - Limits::kQmin) / (Limits::kQmax - Limits::kQmin);
@@ -161,6 +206,9 @@ class SafeFilterParams {
   float drive01() const { return drive01_; }
   float morph01() const { return morph01_; }
 
+  // Coefficients written by the setters
+  const FilterCfg* cfg() const { return cfg_; }
+
  private:
   static inline float clampf(float v, float lo, float hi) {
     return (v < lo) ? lo : ((v > hi) ? hi : v);
@@ -209,7 +257,7 @@ class SafeFilterParams {
                Limits::kQmin, Limits::kQmax);
 
     // Stability cap: Q_stab = 2τ / gCut
-    const float g = tanf(float(math::PI_F) * hz / kSR);
+    const float g = math::fast::tanPi<math::fast::Tier::High>(hz / kSR);
     const float Q_stab = 2.f * Limits::kStabTau / fmaxf(g, 1e-20f);
 
     return fminf(Q_ui, clampf(Q_stab, Limits::kQmin, Limits::kQmax));
@@ -0,0 +1,19 @@
+#pragma once
+#include <stdint.h>
+
+namespace zlkm::audio {
+
+// Timestamped control event for one audio block. Lists handed to an
+// engine's fillBlock are sorted by offset.
+struct Event {
+  enum Type : uint8_t {
+    Trigger = 0,  // value: velocity 0..1 (reserved; engines may ignore it)
+  };
+
+  uint16_t offset = 0;  // frame within the block, at the output rate
+  Type type = Trigger;
+  uint8_t target = 0;  // instrument, for hosts that run several
+  float value = 1.f;   // type-specific payload
+};
+
+}  // namespace zlkm::audio
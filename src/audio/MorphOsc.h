@@ -5,6 +5,8 @@
 
 #include "dsp/Blep.h"
 #include "dsp/Util.h"
+#include "dsp/WaveTable.h"
+#include "math/Fast.h"
 #include "math/Util.h"
 #include "platform/platform.h"
 
@@ -22,26 +24,30 @@ class MorphOscN {
   static constexpr float SQUARE_BOUND = 2.0f / SEGMENT_COUNT;
   static constexpr float SAW_BOUND = 1.0f;
 
-  static constexpr float INV_SINE_TRI_LEN = 1.f / (TRIANGLE_BOUND - SINE_BOUND);
-  static constexpr float INV_TRI_SQ_LEN = 1.f / (SQUARE_BOUND - TRIANGLE_BOUND);
-  static constexpr float INV_SQ_SAW_LEN = 1.f / (SAW_BOUND - SQUARE_BOUND);
-
   // For a ±1 triangle: slopes ±4 → slope jump magnitude 8
   static constexpr float TRI_JUMP = 8.0f;
 
   // per-sample normalized increment: dt = f / SR
   static constexpr float FREQ_TO_T = 1.0f / SR;
 
-  struct alignas(16) State {
-    float morph = 0.0f;          // 0..1
-    float pulseWidth = 0.5f;     // 0..1
-    dsp::Injector2TapX2 blep{};  // now dt in [0,1) and the result in +-1
-    float cyclesPerSample = 0.0f;
-    float phase = 0.0f;  // t in [0,1)
+  // ModeTable plays the same morph from mip-mapped band-limited tables:
+  // flat per-voice cost and no aliasing from BLEP at high pitches
+  enum Mode { ModeMorph = 0, ModeSwitch, ModeTable };
+
+  using Tables = dsp::MipWaveTables<>;
+
+  // Structure-of-arrays voice state: one contiguous lane per field so the
+  // per-voice kernels below vectorize across voices.
+  struct State {
+    alignas(16) std::array<float, N> phase{};       // t in [0,1)
+    alignas(16) std::array<float, N> dt{};          // cycles per sample
+    alignas(16) std::array<float, N> morph{};       // 0..1
+    alignas(16) std::array<float, N> pulseWidth{};  // 0..1
+    alignas(16) std::array<float, N> carry{};       // polyBLEP next-sample tap
   };
 
-  // --- Primitive naive generators (only when needed) ---
-  static inline float sine_naive(float t0) { return dsp::sin01_poly7(t0); }
+  // --- Primitive naive generators ---
+  static inline float sine_naive(float t0) { return math::fast::sin01(t0); }
   static inline float triangle_naive(float t0) {
     // 1 - 4*|t - 0.5|
     return 1.0f - 4.0f * fabsf(t0 - 0.5f);
@@ -52,133 +58,167 @@ class MorphOscN {
   }
   static inline float saw_naive(float t0) { return 2.0f * t0 - 1.0f; }
 
-  inline float square_blep(State& s, float t0, float dt, float overshoot,
-                           float pw, float amp) {
-    if (amp <= 0.f) {
-      return 0.f;
-    }
-    float s_sq = square_naive(t0, pw);
-    [[likely]] if (overshoot <= 0.f) {
-      [[likely]] if (t0 >= pw || (t0 + dt) < pw) { return s_sq; }
-      const float frac = (pw - t0) / dt;
-      s_sq += s.blep.discontinuity(frac, -amp);  // +1 -> -1
-      return s_sq;
-    }
-    const float frac_rise = 1.0f - (overshoot / dt);
-    s_sq += s.blep.discontinuity(frac_rise, amp);  // -1 -> +1
-
-    [[likely]] if (overshoot <= pw) { return s_sq; }
-    const float frac_fall = ((1.0f - t0) + pw) / dt;
-    s_sq += s.blep.discontinuity(frac_fall, -amp);  // +1 -> -1
-    return s_sq;
-  }
+  State state = {};  // per-voice state
+  Mode mode = ModeMorph;
 
-  inline float saw_blep(State& s, float t0, float dt, float overshoot,
-                        float amp) {
-    if (amp <= 0.f) {
-      return 0.f;
-    }
-    float saw = saw_naive(t0);
-    [[likely]] if (overshoot <= 0)
-      return saw;
-    const float frac = 1.0f - (overshoot / dt);
-    saw += s.blep.discontinuity(frac, amp);  // +1 -> -1 at wrap
-    return saw;
+  MorphOscN() {
+    state.pulseWidth.fill(0.5f);
+    Tables::instance();  // build the tables now, not on the audio core
   }
 
-  float tickMorph(int i) {
-    State& s = state[i];
-
-    // Start with shared carry, once per sample
-    float sample = s.blep.apply();
-
-    const float dt = s.cyclesPerSample;  // s.phaseInc;
-    const float sum = s.phase + dt;
-    const float overshoot = sum - 1.0f;
-    const float pw = s.pulseWidth;
-
-    const int seg = (int)(s.morph * SEGMENT_COUNT);
-
-    switch (seg) {
-      case 0: {
-        const float wB = (s.morph - SINE_BOUND) * INV_SINE_TRI_LEN;
-        const float wA = 1.0f - wB;
-        sample += wA * sine_naive(s.phase) + wB * triangle_naive(s.phase);
-      } break;
-      case 1: {
-        const float wB = (s.morph - TRIANGLE_BOUND) * INV_TRI_SQ_LEN;
-        const float wA = 1.0f - wB;
-        const float s_tri = (wA > 0.0f) ? triangle_naive(s.phase) : 0.0f;
-        const float s_sq = square_blep(s, s.phase, dt, overshoot, pw, wB);
-        sample += wA * s_tri + wB * s_sq;
-      } break;
-      default: {
-        const float wB = (s.morph - SQUARE_BOUND) * INV_SQ_SAW_LEN;
-        const float wA = 1.0f - wB;
-        const float s_sq = square_blep(s, s.phase, dt, overshoot, pw, wA);
-        const float s_saw = saw_blep(s, s.phase, dt, overshoot, wB);
-        sample += wA * s_sq + wB * s_saw;
-      } break;
+  // Call on trigger/note-on; resets phase
+  void reset(const bool randomPhase = false) {
+    for (int i = 0; i < N; ++i) {
+      state.phase[i] = randomPhase ? math::rand01() : 0.0f;
     }
-    s.phase = sum - (float)(overshoot > 0.f);
-    return sample;
   }
 
-  // useful to debug just the waveforms
-  float ticSwitch(int i) {
-    State& s = state[i];
-
-    // Start with shared carry, once per sample
-    float sample = s.blep.apply();
-
-    const float dt = s.cyclesPerSample;  // s.phaseInc;
-    const float sum = s.phase + dt;
-    const float overshoot = sum - 1.0f;
-    const float pw = s.pulseWidth;
-
-    const int seg = (int)(s.morph * WAVE_COUNT);
-
-    switch (seg) {
-      case 0: {
-        sample += sine_naive(s.phase);
-      } break;
-      case 1:
-        sample += triangle_naive(s.phase);
+  // Render 'frames' samples for the first VN voices into 'out', frame-major
+  // with stride N (out[f * N + i]). perFrame(f, state) runs before each frame
+  // so callers can update dt/morph per sample; the mode switch is resolved
+  // once per block.
+  template <int VN = N, class PerFrame>
+  inline void renderBlock(float* out, int frames, PerFrame&& perFrame) {
+    static_assert(VN > 0 && VN <= N, "VN must be in 1..N");
+    switch (mode) {
+      case ModeSwitch:
+        renderBlock_<VN, ModeSwitch>(out, frames, perFrame);
         break;
-      case 2:
-        sample += square_blep(s, s.phase, dt, overshoot, pw, 1.f);
+      case ModeTable:
+        renderTable_<VN>(out, frames, perFrame);
         break;
       default:
-        sample += saw_blep(s, s.phase, dt, overshoot, 1.f);
+        renderBlock_<VN, ModeMorph>(out, frames, perFrame);
         break;
     }
-    s.phase = sum - (float)(overshoot > 0.f);
-    return sample;
   }
 
-  enum Mode { ModeMorph = 0, ModeSwitch };
+  inline void tick(std::array<float, N>& out) {
+    renderBlock(out.data(), 1, [](int, State&) {});
+  }
+
+ private:
+  // Per-voice waveform weights. Morph: piecewise-linear hats over
+  // sine->tri->square->saw. Switch: one-hot (useful to debug the waveforms).
+  template <Mode M>
+  static inline void weights(float morph, float& wSine, float& wTri,
+                             float& wSq, float& wSaw) {
+    if constexpr (M == ModeSwitch) {
+      const int seg = (int)(morph * WAVE_COUNT);
+      wSine = (float)(seg <= 0);
+      wTri = (float)(seg == 1);
+      wSq = (float)(seg == 2);
+      wSaw = (float)(seg >= 3);
+    } else {
+      const float m = morph * SEGMENT_COUNT;
+      wSine = math::clamp(1.0f - m, 0.0f, 1.0f);
+      wTri = fmaxf(0.0f, 1.0f - fabsf(m - 1.0f));
+      wSq = fmaxf(0.0f, 1.0f - fabsf(m - 2.0f));
+      wSaw = math::clamp(m - 2.0f, 0.0f, 1.0f);
+    }
+  }
 
-  std::array<State, N> state = {};  // per-voice state
+  // One frame = a handful of tight loops over voices, one per waveform
+  // kernel. Kernels whose weight is zero for every voice are skipped.
+  template <int VN, Mode M, class PerFrame>
+  inline void renderBlock_(float* out, int frames, PerFrame& perFrame) {
+    State& s = state;
+    alignas(16) std::array<float, N> wSine, wTri, wSq, wSaw;
+    for (int f = 0; f < frames; ++f, out += N) {
+      perFrame(f, s);
+
+      float anySine = 0.f, anyTri = 0.f, anySq = 0.f, anySaw = 0.f;
+      for (int i = 0; i < VN; ++i) {
+        weights<M>(s.morph[i], wSine[i], wTri[i], wSq[i], wSaw[i]);
+        anySine += wSine[i];
+        anyTri += wTri[i];
+        anySq += wSq[i];
+        anySaw += wSaw[i];
+        // Start with the carried BLEP tap from the previous sample
+        out[i] = s.carry[i];
+        s.carry[i] = 0.f;
+      }
 
-  Mode mode;
+      if (anySine > 0.f) {
+        for (int i = 0; i < VN; ++i) {
+          out[i] += wSine[i] * sine_naive(s.phase[i]);
+        }
+      }
+      if (anyTri > 0.f) {
+        for (int i = 0; i < VN; ++i) {
+          out[i] += wTri[i] * triangle_naive(s.phase[i]);
+        }
+      }
+      if (anySq > 0.f) {
+        // Square + falling edge (+1 -> -1) at pw: before the wrap when the
+        // step crosses pw, after it when the overshoot passes pw.
+        for (int i = 0; i < VN; ++i) {
+          const float t0 = s.phase[i];
+          const float dt = s.dt[i];
+          const float pw = s.pulseWidth[i];
+          const float sum = t0 + dt;
+          const float overshoot = sum - 1.0f;
+          const bool wrap = overshoot > 0.0f;
+          const bool fall = wrap ? (overshoot > pw) : (t0 < pw && sum >= pw);
+          const float frac = wrap ? (1.0f - t0 + pw) / dt : (pw - t0) / dt;
+          out[i] += wSq[i] * square_naive(t0, pw) +
+                    dsp::polyBlep2(fall ? frac : 0.f, fall ? -wSq[i] : 0.f,
+                                   s.carry[i]);
+        }
+      }
+      if (anySaw > 0.f) {
+        for (int i = 0; i < VN; ++i) {
+          out[i] += wSaw[i] * saw_naive(s.phase[i]);
+        }
+      }
+      if (anySq + anySaw > 0.f) {
+        // Wrap: square rises (-1 -> +1) and saw resets at the same position
+        for (int i = 0; i < VN; ++i) {
+          const float overshoot = s.phase[i] + s.dt[i] - 1.0f;
+          const bool wrap = overshoot > 0.0f;
+          const float frac = 1.0f - overshoot / s.dt[i];
+          out[i] += dsp::polyBlep2(wrap ? frac : 0.f,
+                                   wrap ? wSq[i] + wSaw[i] : 0.f, s.carry[i]);
+        }
+      }
 
-  // Call on trigger/note-on; latches pan & resets phase
-  void reset(const bool randomPhase = false) {
-    for (int i = 0; i < N; ++i) {
-      state[i].phase = randomPhase ? math::rand01() : 0.0f;  // store t in [0,1)
+      advance_<VN>(s);
     }
   }
 
-  inline void tick(std::array<float, N>& out) {
-    for (int i = 0; i < N; ++i) {
-      switch (mode) {
-        case ModeSwitch:
-          out[i] = ticSwitch(i);
-          break;
-        default:
-          out[i] = tickMorph(i);
-          break;
+  // Table mode: per voice, pick the mip level from dt and crossfade the
+  // interpolated frames with the morph weights. Pulse is the difference of
+  // two band-limited saws offset by pw:
+  //   square(t) = saw(t - pw) - saw(t) + 2*pw - 1
+  template <int VN, class PerFrame>
+  inline void renderTable_(float* out, int frames, PerFrame& perFrame) {
+    State& s = state;
+    const Tables& tb = Tables::instance();
+    for (int f = 0; f < frames; ++f, out += N) {
+      perFrame(f, s);
+      for (int i = 0; i < VN; ++i) {
+        float wSine, wTri, wSq, wSaw;
+        weights<ModeMorph>(s.morph[i], wSine, wTri, wSq, wSaw);
+        const int lvl = Tables::level(s.dt[i]);
+        const float t0 = s.phase[i];
+        const float pw = s.pulseWidth[i];
+        float t1 = t0 - pw;
+        t1 += (float)(t1 < 0.0f);
+        const float saw = tb.saw(lvl, t0);
+        const float sq = tb.saw(lvl, t1) - saw + 2.0f * pw - 1.0f;
+        out[i] = wSine * tb.sine(t0) + wTri * tb.tri(lvl, t0) + wSq * sq +
+                 wSaw * saw;
+        s.carry[i] = 0.f;  // no BLEP tail when switching back
       }
+      advance_<VN>(s);
+    }
+  }
+
+  template <int VN>
+  static inline void advance_(State& s) {
+    for (int i = 0; i < VN; ++i) {
+      const float sum = s.phase[i] + s.dt[i];
+      s.phase[i] = sum - (float)(sum > 1.0f);
     }
   }
 };
@@ -0,0 +1,73 @@
+#pragma once
+#include <stdint.h>
+
+#include <span>
+
+#if defined(__ARM_FEATURE_SAT)
+#include <arm_acle.h>
+#endif
+
+namespace zlkm::audio {
+
+// Signed saturation to BITS bits (single SSAT on Cortex-M with DSP ext.)
+template <int BITS>
+static inline int32_t ssat(int32_t v) {
+#if defined(__ARM_FEATURE_SAT)
+  return __ssat(v, BITS);
+#else
+  constexpr int32_t hi = (int32_t(1) << (BITS - 1)) - 1;
+  constexpr int32_t lo = -hi - 1;
+  return v < lo ? lo : v > hi ? hi : v;
+#endif
+}
+
+// Float -> wire format for TR, written straight into TR::BufferT.
+//   16 bit:          int16
+//   24 bit:          24-in-32, MSB-aligned (s24 << 8)
+//   24 bit, PACK24:  3 little-endian bytes per sample, no pad byte
+//   32 bit:          Q23 << 8; a float carries 24 significant bits anyway
+// Samples are scaled to Q(RES-1) in the float domain and saturated with
+// integer ops; inputs must stay within +-256 full scale (the soft clipper
+// keeps the chain far below that).
+template <class TR>
+struct Pcm {
+  using BufferT = typename TR::BufferT;
+
+  static constexpr int RES = TR::BITS == 16 ? 16 : 24;  // resolution
+  static constexpr int SHIFT = TR::PACK24 ? 0 : TR::BITS == 16 ? 0 : 8;
+  static constexpr float SCALE = float(int32_t(1) << (RES - 1));
+
+  static inline int32_t quantize(float x) {
+    return ssat<RES>((int32_t)(x * SCALE));
+  }
+
+  // Write sample 'idx' (interleaved element index) of 'dst'
+  static inline void put(BufferT& dst, int idx, float x) {
+    const int32_t v = quantize(x);
+    if constexpr (TR::PACK24) {
+      uint8_t* p = &dst[3 * idx];
+      p[0] = uint8_t(v);
+      p[1] = uint8_t(v >> 8);
+      p[2] = uint8_t(v >> 16);
+    } else {
+      dst[idx] = typename TR::SampleT(uint32_t(v) << SHIFT);
+    }
+  }
+
+  // Write frame 'i'; mono builds get the L/R average
+  static inline void putFrame(BufferT& dst, int i, float l, float r) {
+    if constexpr (TR::STEREO) {
+      put(dst, 2 * i + 0, l);
+      put(dst, 2 * i + 1, r);
+    } else {
+      put(dst, i, 0.5f * (l + r));
+    }
+  }
+
+  static inline void write(std::span<const float> l, std::span<const float> r,
+                           BufferT& dst) {
+    for (size_t i = 0; i < l.size(); ++i) putFrame(dst, int(i), l[i], r[i]);
+  }
+};
+
+}  // namespace zlkm::audio
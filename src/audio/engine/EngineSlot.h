@@ -0,0 +1,69 @@
+#pragma once
+#include <stddef.h>
+
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace zlkm::audio::engine {
+
+// Construction tag: select() asks make(Tag<E>{}) for E's constructor arg
+template <class E>
+using Tag = std::in_place_type_t<E>;
+
+// Holds one of Engines in place (std::variant, no heap, no virtuals).
+//
+// The caller visits once per block and runs the active engine's concrete
+// block code, so per-sample loops are the same as with a plain member.
+// select() switches engines: the old one is destroyed and the new one
+// constructed in the same storage, so call it at a block boundary. Starts
+// empty; visit() skips an empty slot.
+template <class... Engines>
+class EngineSlot {
+ public:
+  static constexpr size_t size() { return sizeof...(Engines); }
+
+  // Index into Engines of the active engine; size() when empty
+  size_t index() const { return empty() ? size() : v_.index() - 1; }
+  bool empty() const { return v_.index() == 0; }
+
+  // Make engine 'i' active unless it already is. 'make' is called as
+  // make(Tag<E>{}) and returns what E is constructed from. True on a switch.
+  template <class Make>
+  bool select(size_t i, Make&& make) {
+    if (i >= size() || i == index()) return false;
+    emplace_(i, make, std::index_sequence_for<Engines...>{});
+    return true;
+  }
+
+  // The active engine if it is an E, else nullptr
+  template <class E>
+  E* get() {
+    return std::get_if<E>(&v_);
+  }
+
+  // f(E&) on the active engine
+  template <class F>
+  void visit(F&& f) {
+    std::visit(
+        [&](auto& e) {
+          if constexpr (!std::is_same_v<std::decay_t<decltype(e)>,
+                                        std::monostate>) {
+            f(e);
+          }
+        },
+        v_);
+  }
+
+ private:
+  template <class Make, size_t... I>
+  void emplace_(size_t i, Make& make, std::index_sequence<I...>) {
+    ((i == I ? (void)v_.template emplace<I + 1>(make(Tag<Engines>{}))
+             : void()),
+     ...);
+  }
+
+  std::variant<std::monostate, Engines...> v_;
+};
+
+}  // namespace zlkm::audio::engine
@@ -0,0 +1,212 @@
+#pragma once
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <span>
+#include <utility>
+
+#include "math/Fast.h"
+#include "mod/ADEnvelopes.h"
+#include "util/Profiler.h"
+
+namespace zlkm::audio::engine {
+
+// ---------------- FM ----------------
+// OPS sine operators (2..4) in fixed algorithms. Operator i can only be
+// modulated by operators above it, so a frame evaluates OPS-1 down to 0;
+// the top operator has self-feedback. Each operator has its own AD
+// envelope, retriggered by reset(), scaling its level: modulation index for
+// modulators, output gain for carriers. Output is mono on both channels.
+//
+// Operator state is kept structure-of-arrays and the envelope * level
+// gains are computed per chunk, so the per-frame loop is OPS sines and
+// phase steps. Each algorithm is its own kernel with the routing known at
+// compile time, as with Swarm's per-voice-count kernels.
+template <int OPS>
+class FM {
+  static_assert(OPS >= 2 && OPS <= 4, "FM supports 2..4 operators");
+  static constexpr int kChunkFrames = 16;
+  // Modulator level 1 = this many cycles of phase deviation (~2pi rad)
+  static constexpr float kIndexScale = 1.f;
+  static constexpr float kFeedbackScale = 0.25f;
+
+  // mods[i]: operators modulating operator i; carriers: summed to output
+  struct Algo {
+    std::array<uint8_t, 4> mods;
+    uint8_t carriers;
+  };
+  static constexpr uint8_t kOpMask = uint8_t((1u << OPS) - 1u);
+
+ public:
+  using Envelopes = mod::ADEnvelopes<OPS>;
+  using EnvCfg = mod::EnvCfg;
+
+  static constexpr std::array<Algo, 4> kAlgos = {{
+      {{0b0010, 0b0100, 0b1000, 0}, 0b0001},  // 3 > 2 > 1 > 0
+      {{0b0010, 0, 0b1000, 0}, 0b0101},       // 3 > 2, 1 > 0
+      {{0b1110, 0, 0, 0}, 0b0001},            // 1 + 2 + 3 > 0
+      {{0b1000, 0b1000, 0b1000, 0}, 0b0111},  // 3 > 0, 1, 2
+  }};
+  static constexpr int kAlgorithms = int(kAlgos.size());
+
+  struct Cfg {
+    // Ramped across a block; keep contiguous (see i_begin())
+    std::array<float, OPS> ratio = initRatio_();  // x base pitch
+    std::array<float, OPS> level = initLevel_();  // 0..1
+    float feedback = 0.1f;                        // top operator, 0..1
+    static constexpr int INTERPOLATABLE_PARAMS = 2 * OPS + 1;
+    float* i_begin() { return ratio.data(); }
+    const float* i_begin() const { return ratio.data(); }
+
+    // Set immediately
+    int algorithm = 0;  // index into kAlgos
+  };
+
+  explicit FM(const Cfg& c) : cfg_(c) { setImmediate_(c); }
+
+  // Operator envelopes; rates are per sample at the render rate
+  void setEnvs(const std::array<EnvCfg, OPS>& e) { envs_.setEnvs(e); }
+
+  // Retrigger: phases to zero so every hit starts alike
+  void reset() {
+    phase_.fill(0.f);
+    fb_ = {0.f, 0.f};
+    envs_.triggerAll();
+  }
+
+  // Per-sample pitch in (cycles per sample), mono into outL/outR.
+  // 'target' as in SwarmMorph::processBlock().
+  void processBlock(std::span<const float> cyclesPerSample,
+                    std::span<float> outL, std::span<float> outR,
+                    const Cfg& target, bool targetChanged = true) {
+    ZLKM_PERF_SCOPE("FM::processBlock");
+    if (targetChanged) setImmediate_(target);
+    (this->*block_)(cyclesPerSample, outL, outR,
+                    targetChanged ? &target : nullptr);
+  }
+
+  // Silent fast path: jump to 'target' and drop feedback history
+  void park(const Cfg& target) {
+    setImmediate_(target);
+    std::copy_n(target.i_begin(), Cfg::INTERPOLATABLE_PARAMS,
+                cfg_.i_begin());
+    fb_ = {0.f, 0.f};
+  }
+
+  const Cfg& cfg() const { return cfg_; }
+
+ private:
+  using BlockKernel = void (FM::*)(std::span<const float>, std::span<float>,
+                                   std::span<float>, const Cfg*);
+
+  static constexpr std::array<float, OPS> initRatio_() {
+    constexpr float r[4] = {1.f, 1.41f, 3.53f, 7.11f};
+    std::array<float, OPS> a{};
+    for (int i = 0; i < OPS; ++i) a[i] = r[i];
+    return a;
+  }
+  static constexpr std::array<float, OPS> initLevel_() {
+    constexpr float l[4] = {1.f, .45f, .3f, .2f};
+    std::array<float, OPS> a{};
+    for (int i = 0; i < OPS; ++i) a[i] = l[i];
+    return a;
+  }
+
+  void setImmediate_(const Cfg& c) {
+    cfg_.algorithm = std::clamp(c.algorithm, 0, kAlgorithms - 1);
+    static constexpr auto kBlock =
+        []<int... A>(std::integer_sequence<int, A...>) {
+          return std::array<BlockKernel, kAlgorithms>{
+              &FM::template processBlock_<A>...};
+        }(std::make_integer_sequence<int, kAlgorithms>{});
+    block_ = kBlock[cfg_.algorithm];
+  }
+
+  template <int ALG>
+  void processBlock_(std::span<const float> cyclesPerSample,
+                     std::span<float> outL, std::span<float> outR,
+                     const Cfg* target) {
+    static constexpr Algo kA = kAlgos[ALG];
+    static constexpr uint8_t kCarriers = kA.carriers & kOpMask;
+    static constexpr float kOutScale = 1.f / float(std::popcount(kCarriers));
+    static_assert(kCarriers & 1, "operator 0 is always a carrier");
+
+    const int frames = int(outL.size());
+    float* cur = cfg_.i_begin();
+    const bool ramp = target != nullptr;
+    std::array<float, Cfg::INTERPOLATABLE_PARAMS> step{};
+    if (ramp) {
+      const float inv = 1.f / float(frames);
+      for (int k = 0; k < Cfg::INTERPOLATABLE_PARAMS; ++k) {
+        step[k] = (target->i_begin()[k] - cur[k]) * inv;
+      }
+    }
+
+    std::array<float, OPS> ph = phase_;
+    float fb0 = fb_[0], fb1 = fb_[1];
+    for (int f0 = 0; f0 < frames; f0 += kChunkFrames) {
+      const int n = std::min(kChunkFrames, frames - f0);
+
+      // Envelope * level * role scale per operator, SoA
+      for (int op = 0; op < OPS; ++op) {
+        std::span<float> g(gain_[op].data(), size_t(n));
+        envs_.processBlock(op, g);
+        const float k = ((kCarriers >> op) & 1 ? kOutScale : kIndexScale);
+        float lvl = cfg_.level[op];
+        const float dl = ramp ? step[OPS + op] : 0.f;
+        for (int f = 0; f < n; ++f) {
+          lvl += dl;
+          g[f] *= k * lvl;
+        }
+      }
+
+      for (int f = 0; f < n; ++f) {
+        if (ramp) {
+          for (int k = 0; k < Cfg::INTERPOLATABLE_PARAMS; ++k) {
+            cur[k] += step[k];
+          }
+        }
+        const float c0 = cyclesPerSample[f0 + f];
+        std::array<float, OPS> y;
+        float out = 0.f;
+        for (int op = OPS - 1; op >= 0; --op) {
+          float pm = 0.f;
+          for (int j = op + 1; j < OPS; ++j) {
+            if ((kA.mods[op] >> j) & 1) pm += y[j];
+          }
+          if (op == OPS - 1) {
+            pm += cfg_.feedback * kFeedbackScale * (fb0 + fb1);
+          }
+          y[op] = math::fast::sin01(ph[op] + pm) * gain_[op][f];
+          if ((kCarriers >> op) & 1) out += y[op];
+          ph[op] += c0 * cfg_.ratio[op];
+          ph[op] -= float(ph[op] >= 1.f);
+        }
+        fb1 = fb0;
+        fb0 = y[OPS - 1];
+        outL[f0 + f] = out;
+        outR[f0 + f] = out;
+      }
+    }
+    phase_ = ph;
+    fb_ = {fb0, fb1};
+    // Land exactly on the target so held blocks can skip the ramp
+    if (ramp) {
+      std::copy_n(target->i_begin(), Cfg::INTERPOLATABLE_PARAMS, cur);
+    }
+  }
+
+  Cfg cfg_;
+  BlockKernel block_ = nullptr;
+  Envelopes envs_;
+
+  std::array<float, OPS> phase_{};
+  std::array<float, 2> fb_{};  // last two outputs of the top operator
+  std::array<std::array<float, kChunkFrames>, OPS> gain_{};
+};
+
+}  // namespace zlkm::audio::engine
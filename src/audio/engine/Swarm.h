@@ -1,9 +1,14 @@
 #pragma once
 #include <math.h>
 
+#include <algorithm>
 #include <array>
+#include <span>
+#include <utility>
 
 #include "audio/MorphOsc.h"
+#include "math/Fast.h"
+#include "util/Profiler.h"
 
 namespace zlkm::audio::engine {
 
@@ -12,6 +17,11 @@ template <int N, int SR>
 class SwarmMorph {
   static constexpr int kMaxSwarmVoices = N;
   static constexpr float INV_SR_F = 1.f / float(SR);
+  static constexpr int kChunkFrames = 16;
+  static constexpr float kEqualPan = 0.70710678f;  // 1/sqrt(2)
+
+  using MorphOsc = MorphOscN<N, SR>;
+  using OscState = typename MorphOsc::State;
 
  public:
   struct Cfg {
@@ -31,19 +41,25 @@ class SwarmMorph {
 
     // Set immediately
     int voices = 7;        // 1..N
-    int morphMode;         // 0 -> Morph, 1 -> Switch between waveforms (debug)
+    int morphMode = 0;     // 0 -> Morph, 1 -> Switch (debug), 2 -> Table
     bool randomPhase = 1;  // randomize start phase, int
   };
 
-  explicit SwarmMorph(const Cfg& c) : cfg_(c) { cfgUpdated(); }
+  explicit SwarmMorph(const Cfg& c) : cfg_(c) {
+    cfg_.voices = std::clamp(cfg_.voices, 1, N);
+    selectKernels_();
+    cfgUpdated();
+  }
 
   void cfgUpdated() {
     for (int i = 0; i < cfg_.voices; ++i) {
-      osc_.state[i].pulseWidth = cfg_.pulseWidth;
+      osc_.state.pulseWidth[i] = cfg_.pulseWidth;
     }
   }
 
   void reset() {
+    cfg_.voices = std::clamp(cfg_.voices, 1, N);
+    selectKernels_();
     const int VN = cfg_.voices;
     seedDetune(VN);
     seedPan(VN);
@@ -54,30 +70,103 @@ class SwarmMorph {
   inline void tickStereo(const float cyclesPerSample, const float swarmEnv,
                          const float morphEnv, float& outL, float& outR) {
     ZLKM_PERF_SCOPE_SAMPLED("Swarm::tickStereo", 6);
-    const int VN = cfg_.voices;
+    (this->*tick_)(cyclesPerSample, swarmEnv, morphEnv, outL, outR);
+  }
+
+  // Block form of tickStereo(): per-sample pitch and envelopes in, stereo
+  // out. The interpolatable Cfg params ramp linearly towards 'target' across
+  // the block; voices, morphMode and randomPhase are taken from 'target' at
+  // the block boundary. With 'targetChanged' false the caller vouches that
+  // 'target' is what the last ramp ended on, and params are held as-is.
+  void processBlock(std::span<const float> cyclesPerSample,
+                    std::span<const float> swarmEnv,
+                    std::span<const float> morphEnv, std::span<float> outL,
+                    std::span<float> outR, const Cfg& target,
+                    bool targetChanged = true) {
+    ZLKM_PERF_SCOPE("Swarm::processBlock");
+    if (targetChanged) setImmediate_(target);
+    (this->*block_)(cyclesPerSample, swarmEnv, morphEnv, outL, outR,
+                    targetChanged ? &target : nullptr);
+  }
+
+  // Silent fast path: jump straight to 'target' and drop pending BLEP taps,
+  // so the next trigger starts from a clean state
+  void park(const Cfg& target) {
+    setImmediate_(target);
+    const auto& tgt = target.asTarget();
+    std::copy(tgt.begin(), tgt.end(), cfg_.i_begin());
+    cfgUpdated();
+    osc_.state.carry.fill(0.f);
+  }
+
+  Cfg& cfg() { return cfg_; }
+
+ private:
+  // Kernels are instantiated for every voice count 1..N so the per-voice
+  // loops have a compile-time trip count; changing 'voices' swaps pointers.
+  using TickKernel = void (SwarmMorph::*)(float, float, float, float&,
+                                          float&);
+  using BlockKernel = void (SwarmMorph::*)(
+      std::span<const float>, std::span<const float>, std::span<const float>,
+      std::span<float>, std::span<float>, const Cfg*);
+
+  void selectKernels_() {
+    static constexpr auto kTick =
+        []<int... I>(std::integer_sequence<int, I...>) {
+          return std::array<TickKernel, N>{
+              &SwarmMorph::template tickStereo_<I + 1>...};
+        }(std::make_integer_sequence<int, N>{});
+    static constexpr auto kBlock =
+        []<int... I>(std::integer_sequence<int, I...>) {
+          return std::array<BlockKernel, N>{
+              &SwarmMorph::template processBlock_<I + 1>...};
+        }(std::make_integer_sequence<int, N>{});
+    tick_ = kTick[cfg_.voices - 1];
+    block_ = kBlock[cfg_.voices - 1];
+  }
+
+  // Non-interpolated params: applied at once, voice count changes reseed the
+  // detune/pan/gain tables. Newly enabled voices keep their phase but drop
+  // any stale BLEP carry.
+  void setImmediate_(const Cfg& c) {
+    cfg_.morphMode = c.morphMode;
+    cfg_.randomPhase = c.randomPhase;
+    const int VN = std::clamp(c.voices, 1, N);
+    if (VN == cfg_.voices) return;
+    for (int i = cfg_.voices; i < VN; ++i) osc_.state.carry[i] = 0.f;
+    cfg_.voices = VN;
+    selectKernels_();
+    seedDetune(VN);
+    seedPan(VN);
+    seedGains(VN);
+  }
+
+  template <int VN>
+  void tickStereo_(const float cyclesPerSample, const float swarmEnv,
+                   const float morphEnv, float& outL, float& outR) {
     const float c0 = cyclesPerSample;
     osc_.mode = (typename MorphOsc::Mode)cfg_.morphMode;
 
     {
       ZLKM_PERF_SCOPE_SAMPLED("detune", 6);
+      auto& s = osc_.state;
+      const float morph = cfg_.morph + (1.f - cfg_.morph) * morphEnv;
       for (int i = 0; i < VN; ++i) {
-        osc_.state[i].cyclesPerSample =
-            c0 * detuneMul_[i] *
-            math::interpolate(1.f, detuneMul_[i], swarmEnv);
-        osc_.state[i].morph = cfg_.morph + (1.f - cfg_.morph) * morphEnv;
+        s.dt[i] = c0 * detuneMul_[i] *
+                  math::interpolate(1.f, detuneMul_[i], swarmEnv);
+        s.morph[i] = morph;
       }
     }
 
     {
       ZLKM_PERF_SCOPE_SAMPLED("oscillators", 6);
-      osc_.tick(tmp_);
+      osc_.template renderBlock<VN>(tmp_.data(), 1, [](int, OscState&) {});
     }
 
     {
       ZLKM_PERF_SCOPE_SAMPLED("panning", 6);
       float L = 0.f, R = 0.f;
       // per sample (or control-rate), e in [0..1]
-      const float kEqualPan = 0.70710678f;  // 1/sqrt(2)
       for (int i = 0; i < VN; ++i) {
         const float v = gains_[i] * tmp_[i];
         L += v * math::interpolate(kEqualPan, panL_[i], swarmEnv);
@@ -89,12 +178,85 @@ class SwarmMorph {
     }
   }
 
-  Cfg& cfg() { return cfg_; }
+  // Voices are rendered in chunks of kChunkFrames. A null 'target' holds
+  // the params: no per-frame ramp and no per-voice pulse width writes.
+  template <int VN>
+  void processBlock_(std::span<const float> cyclesPerSample,
+                     std::span<const float> swarmEnv,
+                     std::span<const float> morphEnv, std::span<float> outL,
+                     std::span<float> outR, const Cfg* target) {
+    const int frames = (int)outL.size();
+    osc_.mode = (typename MorphOsc::Mode)cfg_.morphMode;
+
+    float* cur = cfg_.i_begin();
+    const bool ramp = target != nullptr;
+    std::array<float, Cfg::INTERPOLATABLE_PARAMS> step{};
+    if (ramp) {
+      const auto& tgt = target->asTarget();
+      const float inv = 1.f / float(frames);
+      for (int k = 0; k < Cfg::INTERPOLATABLE_PARAMS; ++k) {
+        step[k] = (tgt[k] - cur[k]) * inv;
+      }
+    }
+
+    for (int f0 = 0; f0 < frames; f0 += kChunkFrames) {
+      const int n = std::min(kChunkFrames, frames - f0);
+      {
+        ZLKM_PERF_SCOPE("oscillators");
+        auto perFrame = [&](int f, OscState& s) {
+          if (ramp) {
+            for (int k = 0; k < Cfg::INTERPOLATABLE_PARAMS; ++k) {
+              cur[k] += step[k];
+            }
+            for (int i = 0; i < VN; ++i) s.pulseWidth[i] = cfg_.pulseWidth;
+          }
+          const float c0 = cyclesPerSample[f0 + f];
+          const float e = swarmEnv[f0 + f];
+          const float morph =
+              cfg_.morph + (1.f - cfg_.morph) * morphEnv[f0 + f];
+          for (int i = 0; i < VN; ++i) {
+            s.dt[i] = c0 * detuneMul_[i] *
+                      math::interpolate(1.f, detuneMul_[i], e);
+            s.morph[i] = morph;
+          }
+        };
+        osc_.template renderBlock<VN>(tmp_.data(), n, perFrame);
+      }
+      {
+        ZLKM_PERF_SCOPE("panning");
+        // L = sum(g*x*lerp(kEq, panL, e)) = kEq*sum(g*x) + e*sum(g*x*dL)
+        for (int f = 0; f < n; ++f) {
+          const float* x = &tmp_[f * N];
+          float mid = 0.f, sideL = 0.f, sideR = 0.f;
+          for (int i = 0; i < VN; ++i) {
+            const float v = gains_[i] * x[i];
+            mid += v;
+            sideL += v * (panL_[i] - kEqualPan);
+            sideR += v * (panR_[i] - kEqualPan);
+          }
+          const float e = swarmEnv[f0 + f];
+          outL[f0 + f] = kEqualPan * mid + e * sideL;
+          outR[f0 + f] = kEqualPan * mid + e * sideR;
+        }
+      }
+    }
+    // Land exactly on the target so held blocks can skip the ramp
+    if (ramp) {
+      const auto& tgt = target->asTarget();
+      std::copy(tgt.begin(), tgt.end(), cur);
+      cfgUpdated();
+    }
+  }
 
- private:
   // ---------------- helpers ----------------
-  static inline float panGainL(float p) { return sqrtf(0.5f * (1.f - p)); }
-  static inline float panGainR(float p) { return sqrtf(0.5f * (1.f + p)); }
+  // Seeding runs at block rate: exact sqrt is cheap enough
+  using Tier = math::fast::Tier;
+  static inline float panGainL(float p) {
+    return math::fast::sqrt<Tier::High>(0.5f * (1.f - p));
+  }
+  static inline float panGainR(float p) {
+    return math::fast::sqrt<Tier::High>(0.5f * (1.f + p));
+  }
 
   void seedDetune(int VN) {
     const float cents2semi = 0.01f;
@@ -152,19 +314,22 @@ class SwarmMorph {
       curGain *= cfg_.gainBase;
     }
     const float inv = (sum > 0.f) ? 1.f / sum : 1.f;
-    const float norm = inv / sqrtf(float(VN));
+    const float norm = inv / math::fast::sqrt<Tier::High>(float(VN));
     for (int i = 0; i < VN; ++i) gains_[i] *= norm;
   }
 
  private:
-  using MorphOsc = MorphOscN<N, SR>;
   Cfg cfg_;
   MorphOsc osc_;
 
-  std::array<float, N> tmp_{};
+  // Voice outputs, frame-major (tmp_[f * N + i])
+  std::array<float, N * kChunkFrames> tmp_{};
   std::array<float, N> detuneMul_{};
   std::array<float, N> gains_{};
   std::array<float, N> panL_{}, panR_{};
+
+  TickKernel tick_ = nullptr;
+  BlockKernel block_ = nullptr;
 };
 
 }  // namespace zlkm::audio::engine
\ No newline at end of file
@@ -0,0 +1,96 @@
+#pragma once
+#include <stdint.h>
+
+namespace zlkm::audio {
+
+// Output timeline of a sink: when the audio handed to the device so far
+// runs dry. Kept as a frame count from an anchor time so deadlines stay
+// exact even when a block is not a whole number of microseconds.
+//
+// A sink is any class with
+//   template <class Fill> uint32_t service(uint32_t nowUs, Fill&& fill);
+//   uint32_t deadlineUs() const;
+//   uint32_t underruns() const;
+//   uint32_t nearMisses() const;
+// service() calls fill(TR::BufferT&) for each block the device can take
+// right now and returns how many it rendered; it never waits.
+template <class TR>
+class BlockClock {
+  static constexpr uint32_t kBlockFrames = uint32_t(TR::BLOCK_FRAMES);
+
+ public:
+  // Handed over with less than this to spare: a near miss
+  static constexpr uint32_t kNearMissFrames = kBlockFrames / 2;
+
+  // A block was handed to the device at nowUs. Arriving after the deadline
+  // means the device ran dry: count it and restart the timeline from now.
+  void queued(uint32_t nowUs) {
+    if (started_ && late(nowUs)) {
+      ++underruns_;
+      started_ = false;
+    }
+    if (!started_) {
+      restart_(nowUs, 0);
+      started_ = true;
+    } else if (aheadFrames(nowUs) < kNearMissFrames) {
+      ++nearMisses_;
+    }
+    frames_ += kBlockFrames;
+  }
+
+  // Reconcile with the device's own fill level: 'frames' still queued at
+  // nowUs, counted in whole blocks (the playing one may be partly done).
+  // Keeps the device clock and micros() from drifting apart.
+  void sync(uint32_t nowUs, uint32_t frames) {
+    if (!started_) return;
+    if (frames == 0) {
+      ++underruns_;
+      started_ = false;
+      return;
+    }
+    const uint32_t ahead = aheadFrames(nowUs);
+    const uint32_t lo = frames > kBlockFrames ? frames - kBlockFrames : 0;
+    if (ahead > frames) {
+      restart_(nowUs, frames);
+    } else if (ahead < lo) {
+      restart_(nowUs, lo);
+    }
+  }
+
+  uint32_t deadlineUs() const {
+    return anchorUs_ + uint32_t(frames_ * 1000000u / uint32_t(TR::SR));
+  }
+
+  bool late(uint32_t nowUs) const {
+    return int32_t(nowUs - deadlineUs()) > 0;
+  }
+
+  // Frames queued but not yet played at nowUs
+  uint32_t aheadFrames(uint32_t nowUs) const {
+    if (!started_ || late(nowUs)) return 0;
+    const uint64_t played =
+        uint64_t(nowUs - anchorUs_) * uint32_t(TR::SR) / 1000000u;
+    return uint32_t(frames_ - played);
+  }
+
+  uint32_t blocksAhead(uint32_t nowUs) const {
+    return (aheadFrames(nowUs) + kBlockFrames - 1) / kBlockFrames;
+  }
+
+  uint32_t underruns() const { return underruns_; }
+  uint32_t nearMisses() const { return nearMisses_; }
+
+ private:
+  void restart_(uint32_t nowUs, uint32_t frames) {
+    anchorUs_ = nowUs;
+    frames_ = frames;
+  }
+
+  uint64_t frames_ = 0;  // queued since anchorUs_
+  uint32_t anchorUs_ = 0;
+  uint32_t underruns_ = 0;
+  uint32_t nearMisses_ = 0;
+  bool started_ = false;
+};
+
+}  // namespace zlkm::audio
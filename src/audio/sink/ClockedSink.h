@@ -0,0 +1,43 @@
+#pragma once
+#include <stdint.h>
+
+#include "audio/sink/BlockClock.h"
+
+namespace zlkm::audio {
+
+// Host stand-in for the DAC: holds up to DEPTH blocks (like the I2S DMA
+// ring) and plays them at exactly SR against the caller's clock. Lets
+// native builds and tests run the pull loop with real deadlines.
+template <class TR, int DEPTH = 2>
+class ClockedSink {
+  static_assert(DEPTH >= 1);
+
+ public:
+  using BufferT = typename TR::BufferT;
+
+  template <class Fill>
+  uint32_t service(uint32_t nowUs, Fill&& fill) {
+    uint32_t n = 0;
+    while (clock_.blocksAhead(nowUs) < uint32_t(DEPTH)) {
+      fill(buf_);
+      clock_.queued(nowUs);
+      ++n;
+    }
+    blocks_ += n;
+    return n;
+  }
+
+  uint32_t deadlineUs() const { return clock_.deadlineUs(); }
+  uint32_t underruns() const { return clock_.underruns(); }
+  uint32_t nearMisses() const { return clock_.nearMisses(); }
+
+  uint32_t blocks() const { return blocks_; }
+  const BufferT& lastBlock() const { return buf_; }
+
+ private:
+  alignas(8) BufferT buf_{};
+  BlockClock<TR> clock_;
+  uint32_t blocks_ = 0;
+};
+
+}  // namespace zlkm::audio
@@ -0,0 +1,64 @@
+#pragma once
+#include <AudioTools.h>
+#include <stdint.h>
+
+#include "audio/sink/RingSink.h"
+#include "platform/boards/Current.h"
+
+namespace zlkm::audio {
+
+// I2S DAC on the current board's pins (PCM510X).
+//
+// The driver's ring is DEPTH one-block buffers plus the two its DMA holds
+// in flight, fed through RingSink, which models the same ring. Between
+// blocks core 1 is free.
+template <class TR, int DEPTH = 2>
+class I2SSink {
+  // arduino-pico's I2S keeps two buffers with the DMA and refuses fewer
+  // than 3 in total
+  static constexpr int kDmaBuffers = 2;
+  static constexpr int kBuffers = DEPTH + kDmaBuffers;
+  static_assert(kBuffers >= 3, "arduino-pico I2S needs at least 3 buffers");
+
+ public:
+  using BufferT = typename TR::BufferT;
+  using CurBoard = zlkm::platform::boards::Current;
+  using SrcPinId = typename CurBoard::SrcPinId;
+
+  I2SSink() {
+    auto icfg = i2s_.defaultConfig(TX_MODE);
+    icfg.sample_rate = TR::SR;
+    icfg.channels = 2;                    // stereo
+    icfg.bits_per_sample = TR::I2S_BITS;  // slot width
+    icfg.buffer_count = kBuffers;
+    icfg.buffer_size = int(TR::BLOCK_BYTES);
+    icfg.pin_bck = getPin_(CurBoard::PIN_BCK);
+    icfg.pin_ws = getPin_(CurBoard::PIN_LRCK);
+    icfg.pin_data = getPin_(CurBoard::PIN_DATA);
+    Log.notice(
+        F("[I2S] BCK=%d WS=%d DATA=%d, %d Hz, %d-bit, ch=%d, %d blocks" CR),
+        icfg.pin_bck, icfg.pin_ws, icfg.pin_data, icfg.sample_rate,
+        icfg.bits_per_sample, icfg.channels, icfg.buffer_count);
+    if (!i2s_.begin(icfg)) {
+      Log.error(
+          F("[I2S] begin() failed; check pins, adjacency, and wiring" CR));
+    }
+  }
+
+  template <class Fill>
+  uint32_t service(uint32_t nowUs, Fill&& fill) {
+    return ring_.service(nowUs, fill);
+  }
+
+  uint32_t deadlineUs() const { return ring_.deadlineUs(); }
+  uint32_t underruns() const { return ring_.underruns(); }
+  uint32_t nearMisses() const { return ring_.nearMisses(); }
+
+ private:
+  static int getPin_(SrcPinId pin) { return zlkm::hw::io::getPin(pin).value; }
+
+  I2SStream i2s_;
+  RingSink<TR, kBuffers, I2SStream> ring_{i2s_};
+};
+
+}  // namespace zlkm::audio
@@ -0,0 +1,67 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#include "audio/sink/BlockClock.h"
+
+namespace zlkm::audio {
+
+// Feeds a stream whose write side is a ring of DEPTH blocks (the I2S DMA
+// ring). StreamT provides availableForWrite() and write(ptr, bytes).
+//
+// A block is rendered only when a whole one fits, so up to DEPTH blocks
+// are queued ahead and a slow render eats into that margin instead of
+// glitching. The driver copies on write, so one staging buffer is enough;
+// a write it only partly takes is finished on the next service() before
+// anything new is rendered.
+template <class TR, int DEPTH, class StreamT>
+class RingSink {
+  static_assert(DEPTH >= 1);
+  static constexpr int kBlockBytes = int(TR::BLOCK_BYTES);
+  static constexpr int kFrameBytes = kBlockBytes / TR::BLOCK_FRAMES;
+  static constexpr int kRingBytes = DEPTH * kBlockBytes;
+
+ public:
+  using BufferT = typename TR::BufferT;
+
+  explicit RingSink(StreamT& out) : out_(out) {}
+
+  template <class Fill>
+  uint32_t service(uint32_t nowUs, Fill&& fill) {
+    if (bytesLeft_) {
+      write_();
+      if (bytesLeft_) return 0;
+    }
+    const int room = out_.availableForWrite();
+    if (room < kBlockBytes) return 0;
+    const int queued = kRingBytes - (room < kRingBytes ? room : kRingBytes);
+    clock_.sync(nowUs, uint32_t(queued / kFrameBytes));
+
+    fill(buf_);
+    clock_.queued(nowUs);
+    writePtr_ = reinterpret_cast<const uint8_t*>(buf_.data());
+    bytesLeft_ = TR::BLOCK_BYTES;
+    write_();
+    return 1;
+  }
+
+  uint32_t deadlineUs() const { return clock_.deadlineUs(); }
+  uint32_t underruns() const { return clock_.underruns(); }
+  uint32_t nearMisses() const { return clock_.nearMisses(); }
+
+ private:
+  void write_() {
+    const size_t wrote = out_.write(writePtr_, bytesLeft_);
+    writePtr_ += wrote;
+    bytesLeft_ -= wrote;
+  }
+
+  StreamT& out_;
+  alignas(8) BufferT buf_{};
+  BlockClock<TR> clock_;
+
+  const uint8_t* writePtr_ = nullptr;
+  size_t bytesLeft_ = 0;
+};
+
+}  // namespace zlkm::audio
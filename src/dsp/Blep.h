@@ -3,6 +3,18 @@
 
 namespace zlkm::dsp {
 
+// Quadratic polyBLEP (support: 2 samples, current + next) for a ±2 step.
+// 'frac' = edge position within the *current* sample, in [0,1); 'amp' = blend
+// weight. Returns this sample's correction and adds the next-sample tap to
+// 'carry' (lane form used by structure-of-arrays oscillators).
+static inline float polyBlep2(float frac, float amp, float& carry) {
+  const float x = frac;
+  const float h0 = (1.0f - x) * (1.0f - x);  // this sample
+  const float h1 = x * x;                    // next sample
+  carry += 0.75f * amp * h1;
+  return 0.75f * amp * h0;
+}
+
 struct Injector2TapX2 {
   float carry = 0.0f;  // next-sample tap
 
@@ -15,12 +27,7 @@ struct Injector2TapX2 {
   // 'amp' = blend weight; internally scaled to delta = 2*amp (±2 step)
   // 'frac' = edge position within the *current* sample, in [0,1)
   inline float discontinuity(float frac, float amp) {
-    const float x = frac;
-    // classic quadratic polyBLEP (support: 2 samples, current + next)
-    const float h0 = (1.0f - x) * (1.0f - x);  // this sample
-    const float h1 = x * x;                    // next sample
-    carry += 0.75f * amp * h1;
-    return 0.75f * amp * h0;
+    return polyBlep2(frac, amp, carry);
   }
 };
 
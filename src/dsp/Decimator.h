@@ -0,0 +1,126 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <span>
+
+namespace zlkm::dsp {
+
+// Half-band FIR coefficient sets (Kaiser-windowed sinc). Only the M unique
+// odd-offset taps are stored: h[C +- (2k+1)] = kH[k], center tap is 0.5 and
+// every other even-offset tap is zero. TAPS = 4M - 1.
+
+// 63 taps: <0.001 dB ripple to 20k, -79 dB from 28k (96k -> 48k)
+struct HalfBand63 {
+  static constexpr int M = 16;
+  static constexpr std::array<float, M> kH = {
+      3.170897492e-01f,  -1.024908412e-01f, 5.779994121e-02f,
+      -3.758664517e-02f, 2.574869286e-02f,  -1.792130051e-02f,
+      1.242999378e-02f,  -8.481800542e-03f, 5.635505577e-03f,
+      -3.609645966e-03f, 2.203640999e-03f,  -1.263210057e-03f,
+      6.648762868e-04f,  -3.089929170e-04f, 1.164049907e-04f,
+      -2.636852900e-05f};
+};
+
+// 23 taps: -71 dB from 76k (192k -> 96k). Only fit as the first stage of a
+// cascade, where the next stage removes the 20k..76k band.
+struct HalfBand23 {
+  static constexpr int M = 6;
+  static constexpr std::array<float, M> kH = {
+      3.098113170e-01f,  -8.301142843e-02f, 3.146643247e-02f,
+      -1.051624609e-02f, 2.421522771e-03f,  -1.715977333e-04f};
+};
+
+// Decimate-by-2 half-band FIR, evaluated only at output rate: per output one
+// center tap plus M symmetric pairs. History lives in front of the input in
+// a linear buffer, so the inner loop has no wrap-around.
+template <class C, int MAX_IN>
+class HalfBandDecimator {
+ public:
+  static constexpr int M = C::M;
+  static constexpr int TAPS = 4 * M - 1;
+  static constexpr int HIST = TAPS - 1;
+  static constexpr int CENTER = 2 * M - 1;  // group delay (input samples)
+
+  void reset() { buf_.fill(0.f); }
+
+  // in.size() must be even and <= MAX_IN; writes in.size() / 2 samples
+  void process(std::span<const float> in, float* out) {
+    const int n = (int)in.size();
+    float* x = buf_.data() + HIST;
+    std::copy(in.begin(), in.end(), x);
+    for (int j = 0; j < n / 2; ++j) {
+      const float* c = x + 2 * j + 1 - CENTER;
+      float acc = 0.5f * c[0];
+      for (int k = 0; k < M; ++k) {
+        acc += C::kH[k] * (c[-(2 * k + 1)] + c[2 * k + 1]);
+      }
+      out[j] = acc;
+    }
+    std::copy(x + n - HIST, x + n, buf_.data());
+  }
+
+ private:
+  std::array<float, HIST + MAX_IN> buf_{};
+};
+
+// OS:1 decimator for blocks of IN_FRAMES oversampled samples. process()
+// returns a view of the decimated block (owned by the decimator, or 'in'
+// itself when OS == 1).
+template <int OS, int IN_FRAMES>
+class Decimator;
+
+template <int IN_FRAMES>
+class Decimator<1, IN_FRAMES> {
+ public:
+  static constexpr int LATENCY = 0;
+  void reset() {}
+  std::span<const float> process(std::span<const float> in) { return in; }
+};
+
+template <int IN_FRAMES>
+class Decimator<2, IN_FRAMES> {
+  using Stage = HalfBandDecimator<HalfBand63, IN_FRAMES>;
+
+ public:
+  static constexpr int LATENCY = Stage::CENTER / 2;  // output samples
+
+  void reset() { hb_.reset(); }
+  std::span<const float> process(std::span<const float> in) {
+    hb_.process(in, out_.data());
+    return {out_.data(), in.size() / 2};
+  }
+
+ private:
+  Stage hb_;
+  std::array<float, IN_FRAMES / 2> out_{};
+};
+
+// 4x: short wide-transition stage first, the steep one at the lower rate
+template <int IN_FRAMES>
+class Decimator<4, IN_FRAMES> {
+  using Stage1 = HalfBandDecimator<HalfBand23, IN_FRAMES>;
+  using Stage2 = HalfBandDecimator<HalfBand63, IN_FRAMES / 2>;
+
+ public:
+  static constexpr int LATENCY = Stage1::CENTER / 4 + Stage2::CENTER / 2;
+
+  void reset() {
+    hb1_.reset();
+    hb2_.reset();
+  }
+  std::span<const float> process(std::span<const float> in) {
+    const size_t half = in.size() / 2;
+    hb1_.process(in, mid_.data());
+    hb2_.process({mid_.data(), half}, out_.data());
+    return {out_.data(), half / 2};
+  }
+
+ private:
+  Stage1 hb1_;
+  Stage2 hb2_;
+  std::array<float, IN_FRAMES / 2> mid_{};
+  std::array<float, IN_FRAMES / 4> out_{};
+};
+
+}  // namespace zlkm::dsp
@@ -0,0 +1,43 @@
+#pragma once
+#include <math.h>
+
+#include <span>
+
+#include "math/Util.h"
+
+namespace zlkm::dsp {
+
+// Final output stage: linear up to kThresh, then a gentle 5% slope.
+// Clipped samples are counted for UI feedback (clipping LED).
+struct SoftClip {
+  static constexpr float kThresh = 0.95f;
+  static constexpr float kSlope = 0.05f;
+
+  static inline float process(float x, int& clipCount) {
+    const float c = math::clamp(x, -kThresh, kThresh);
+    clipCount += (c != x);
+    return c + (x - c) * kSlope;
+  }
+
+  // out[i] = process(in[i] * gain[i]); 'in' and 'out' may alias.
+  // Returns the number of clipped samples.
+  static inline int processBlock(std::span<const float> in,
+                                 std::span<const float> gain,
+                                 std::span<float> out) {
+    int clips = 0;
+    for (size_t i = 0; i < out.size(); ++i) {
+      out[i] = process(in[i] * gain[i], clips);
+    }
+    return clips;
+  }
+
+  // out[i] = process(in[i]), for input already scaled
+  static inline int processBlock(std::span<const float> in,
+                                 std::span<float> out) {
+    int clips = 0;
+    for (size_t i = 0; i < out.size(); ++i) out[i] = process(in[i], clips);
+    return clips;
+  }
+};
+
+}  // namespace zlkm::dsp
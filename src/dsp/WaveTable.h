@@ -0,0 +1,94 @@
+#pragma once
+#include <math.h>
+#include <stdint.h>
+
+#include <array>
+#include <bit>
+
+#include "math/Constants.h"
+#include "math/Util.h"
+
+namespace zlkm::dsp {
+
+// Band-limited single-cycle tables for the morph oscillator: one sine plus
+// triangle and saw at log2(SIZE) octave mip levels. Level k holds harmonics
+// 1..(SIZE/2 >> k). Square/pulse is derived from two saw reads, so pulse
+// width stays modulatable. Tables carry one guard point for interpolation.
+//
+// Built once at startup from the sine table (no libm in the harmonic sums);
+// SIZE=512 is ~39KB of SRAM.
+template <int SIZE = 512>
+class MipWaveTables {
+  static_assert((SIZE & (SIZE - 1)) == 0, "SIZE must be a power of two");
+
+ public:
+  static constexpr int LEVELS = std::bit_width(unsigned(SIZE)) - 1;
+  using Table = std::array<float, SIZE + 1>;
+
+  static const MipWaveTables& instance() {
+    static const MipWaveTables t;
+    return t;
+  }
+
+  // Smallest level k whose top harmonic stays below Nyquist for 'dt' cycles
+  // per sample: dt * SIZE <= 2^k, via the float exponent (ceil(log2)).
+  static inline int level(float dt) {
+    const uint32_t bits = std::bit_cast<uint32_t>(dt * float(SIZE));
+    const int k = int((bits + 0x7FFFFFu) >> 23) - 127;
+    return math::clamp(k, 0, LEVELS - 1);
+  }
+
+  // Harmonic count stored at 'lvl'
+  static constexpr int harmonics(int lvl) { return (SIZE / 2) >> lvl; }
+
+  inline float sine(float t) const { return lerp_(sine_.data(), t); }
+  inline float tri(int lvl, float t) const {
+    return lerp_(tri_[lvl].data(), t);
+  }
+  inline float saw(int lvl, float t) const {
+    return lerp_(saw_[lvl].data(), t);
+  }
+
+ private:
+  MipWaveTables() {
+    for (int n = 0; n <= SIZE; ++n) {
+      sine_[n] = sinf(math::TWO_PI_F * float(n) / float(SIZE));
+    }
+    // Accumulate harmonics once, snapshotting into each level as its
+    // harmonic count is reached (highest level = fewest harmonics).
+    // saw = 2t-1 = -2/pi * sum sin(2pi k t)/k
+    // tri = 1-4|t-0.5| = -8/pi^2 * sum_odd cos(2pi k t)/k^2
+    Table saw{}, tri{};
+    int lvl = LEVELS - 1;
+    for (int k = 1; lvl >= 0; ++k) {
+      const float aSaw = -2.f / (math::PI_F * float(k));
+      const float aTri =
+          (k & 1) ? -8.f / (math::PI_F * math::PI_F * float(k * k)) : 0.f;
+      for (int n = 0; n <= SIZE; ++n) {
+        const int idx = (k * n) & (SIZE - 1);
+        saw[n] += aSaw * sine_[idx];
+        tri[n] += aTri * sine_[(idx + SIZE / 4) & (SIZE - 1)];  // cos
+      }
+      if (k == harmonics(lvl)) {
+        saw_[lvl] = saw;
+        tri_[lvl] = tri;
+        --lvl;
+      }
+    }
+  }
+
+  // t in [0,1]; the index mask maps t == 1 back onto the first point
+  static inline float lerp_(const float* tb, float t) {
+    const float x = t * float(SIZE);
+    const int i = int(x);
+    const float fr = x - float(i);
+    const int i0 = i & (SIZE - 1);
+    return tb[i0] + fr * (tb[i0 + 1] - tb[i0]);
+  }
+
+  Table sine_{};
+  std::array<Table, LEVELS> tri_{};
+  std::array<Table, LEVELS> saw_{};
+};
+
+}  // namespace zlkm::dsp
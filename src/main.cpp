@@ -13,7 +13,7 @@ using namespace zlkm::ch;
 using namespace zlkm::util;
 using namespace zlkm::ui;
 
-using MyAudioCore = audio::AudioCore<CalcisTR, CalcisHumilis>;
+using MyAudioCore = audio::AudioCore<CalcisTR, KitT>;
 using App = app::MainApp<MyAudioCore, UI>;
 
 // ---------- Arduino entry points ----------
@@ -29,11 +29,8 @@ void setup() {
 }
 
 void loop() {
-  {
-    ZLKM_PERF_SCOPE("core0.loop(UI)");
-    App::ui_loop();  // UI tick on core 0
-  }
-  ZLKM_PROFILE_TICK();
+  ZLKM_PERF_SCOPE("core0.loop(UI)");
+  App::ui_loop();  // UI tasks on core 0 (the profiler emits from one)
 }
 
 void setup1() { App::audio_start(); }
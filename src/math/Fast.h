@@ -0,0 +1,177 @@
+#pragma once
+#include <math.h>
+#include <stdint.h>
+
+#include <array>
+#include <bit>
+
+// Fast transcendentals for per-sample use. Each function takes an accuracy
+// tier; polynomials are minimax fits (Remez) on the reduced range.
+//
+//   max error          Low        Mid        High
+//   sin01 (abs)        7e-5       7e-7       2e-7
+//   tanPi (rel)        4e-4       4e-6       8e-7   (x <= 0.45)
+//   exp2 (rel)         8e-5       3e-6       2e-7   (64-entry table)
+//   log2 (abs)         9e-4       6e-6       1e-6   (x in 1e-3..1e4)
+//   tanh (abs)         4e-5       2e-6       3e-7
+//   sqrt (rel)         2e-3       5e-6       exact  (VSQRT)
+//
+// Mid is the default: good enough for pitch/cutoff modulation, a few FMAs.
+namespace zlkm::math::fast {
+
+enum class Tier { Low, Mid, High };
+
+namespace detail {
+
+// Horner over a coefficient array, highest power last
+template <size_t N>
+static inline float horner(const std::array<float, N>& c, float x) {
+  float p = c[N - 1];
+  for (int i = int(N) - 2; i >= 0; --i) p = p * x + c[i];
+  return p;
+}
+
+// sin(2*pi*a) = a * P(a^2), a in [0, 0.25]
+template <Tier T>
+static constexpr auto kSin = [] {
+  if constexpr (T == Tier::Low) {
+    return std::array<float, 3>{6.2812800766e+00f, -4.1095242688e+01f,
+                                7.3585514740e+01f};
+  } else if constexpr (T == Tier::Mid) {
+    return std::array<float, 4>{6.2831640443e+00f, -4.1337142371e+01f,
+                                8.1340768887e+01f, -7.0993433268e+01f};
+  } else {
+    return std::array<float, 5>{6.2831850391e+00f, -4.1341629245e+01f,
+                                8.1599520016e+01f, -7.6518140996e+01f,
+                                3.9311800331e+01f};
+  }
+}();
+
+// 2^f, f in [0, 1)
+template <Tier T>
+static constexpr auto kExp2 = [] {
+  if constexpr (T == Tier::Low) {
+    return std::array<float, 4>{9.9992521856e-01f, 6.9583354051e-01f,
+                                2.2606715539e-01f, 7.8024522664e-02f};
+  } else {
+    return std::array<float, 5>{1.0000025934e+00f, 6.9300383447e-01f,
+                                2.4144275689e-01f, 5.2011460619e-02f,
+                                1.3534167912e-02f};
+  }
+}();
+
+// High tier exp2: 2^(j/64) table, generated at compile time
+constexpr double exp2Series(double x) {
+  // exp(x * ln2) by Taylor series; x in [0, 1) converges well in double
+  const double y = x * 0.69314718055994530942;
+  double term = 1.0, sum = 1.0;
+  for (int k = 1; k < 30; ++k) {
+    term *= y / k;
+    sum += term;
+  }
+  return sum;
+}
+static constexpr int kExp2TableBits = 6;
+static constexpr int kExp2TableSize = 1 << kExp2TableBits;
+static constexpr auto kExp2Table = [] {
+  std::array<float, kExp2TableSize> t{};
+  for (int j = 0; j < kExp2TableSize; ++j) {
+    t[j] = float(exp2Series(double(j) / kExp2TableSize));
+  }
+  return t;
+}();
+
+// Low: log2(1+u) = u * P(u); Mid/High: log2(m) = s * P(s^2),
+// s = (m-1)/(m+1); m in [sqrt(.5), sqrt(2))
+template <Tier T>
+static constexpr auto kLog2 = [] {
+  if constexpr (T == Tier::Low) {
+    return std::array<float, 3>{1.4451520628e+00f, -7.5408136993e-01f,
+                                4.4507034076e-01f};
+  } else if constexpr (T == Tier::Mid) {
+    return std::array<float, 2>{2.8852285696e+00f, 9.8353450915e-01f};
+  } else {
+    return std::array<float, 3>{2.8853912894e+00f, 9.6147080895e-01f,
+                                5.9897388582e-01f};
+  }
+}();
+
+}  // namespace detail
+
+// sin(2*pi*t) for any t (cycles)
+template <Tier T = Tier::Mid>
+static inline float sin01(float t) {
+  t -= floorf(t + 0.5f);  // [-0.5, 0.5)
+  float a = fabsf(t);
+  a = fminf(a, 0.5f - a);  // [0, 0.25] by symmetry
+  const float r = a * detail::horner(detail::kSin<T>, a * a);
+  return copysignf(r, t);
+}
+
+// tan(pi * x) for x in [0, 0.5): the prewarp g = tan(pi * f / SR)
+template <Tier T = Tier::Mid>
+static inline float tanPi(float x) {
+  return sin01<T>(0.5f * x) / sin01<T>(0.5f * x + 0.25f);
+}
+
+// 2^x; x is clamped to the normal float range
+template <Tier T = Tier::Mid>
+static inline float exp2(float x) {
+  x = fminf(fmaxf(x, -126.f), 127.99f);
+  const float xi = floorf(x);
+  const float f = x - xi;
+  float p;
+  if constexpr (T == Tier::High) {
+    const float fj = floorf(f * detail::kExp2TableSize);
+    constexpr float kLn2 = 0.6931471806f;
+    const float r = (f - fj * (1.f / detail::kExp2TableSize)) * kLn2;
+    p = detail::kExp2Table[int(fj)] *
+        (1.f + r * (1.f + r * (0.5f + r * (1.f / 6.f))));
+  } else {
+    p = detail::horner(detail::kExp2<T>, f);
+  }
+  const float scale = std::bit_cast<float>(uint32_t(int(xi) + 127) << 23);
+  return p * scale;
+}
+
+// log2(x), x > 0 and normal
+template <Tier T = Tier::Mid>
+static inline float log2(float x) {
+  // Split into 2^e * m with m in [sqrt(.5), sqrt(2))
+  const uint32_t bits = std::bit_cast<uint32_t>(x);
+  const int32_t i = int32_t(bits - 0x3f3504f3u);
+  const int32_t e = i >> 23;
+  const float m = std::bit_cast<float>(uint32_t(bits - uint32_t(e << 23)));
+  if constexpr (T == Tier::Low) {
+    const float u = m - 1.f;
+    return float(e) + u * detail::horner(detail::kLog2<T>, u);
+  } else {
+    const float s = (m - 1.f) / (m + 1.f);
+    return float(e) + s * detail::horner(detail::kLog2<T>, s * s);
+  }
+}
+
+// tanh(x) = 1 - 2 / (e^2x + 1)
+template <Tier T = Tier::Mid>
+static inline float tanh(float x) {
+  constexpr float k2Log2e = 2.8853900818f;  // 2 / ln 2
+  x = fminf(fmaxf(x, -9.f), 9.f);
+  return 1.f - 2.f / (exp2<T>(x * k2Log2e) + 1.f);
+}
+
+// sqrt(x), x >= 0. Low/Mid: bit-trick rsqrt + Newton; High: hardware
+template <Tier T = Tier::Mid>
+static inline float sqrt(float x) {
+  if constexpr (T == Tier::High) {
+    return __builtin_sqrtf(x);
+  } else {
+    float y = std::bit_cast<float>(0x5f3759dfu -
+                                   (std::bit_cast<uint32_t>(x) >> 1));
+    const float hx = 0.5f * x;
+    y = y * (1.5f - hx * y * y);
+    if constexpr (T == Tier::Mid) y = y * (1.5f - hx * y * y);
+    return x * y;
+  }
+}
+
+}  // namespace zlkm::math::fast
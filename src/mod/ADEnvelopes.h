@@ -2,6 +2,7 @@
 #include <algorithm>
 #include <array>
 #include <cstdint>
+#include <span>
 
 namespace zlkm::mod {
 
@@ -133,14 +134,76 @@ class ADEnvelopes {
     }
   }
 
+  // Block form of update() for envelope i: advances it out.size() samples
+  // and writes value(i) per sample. Envelopes are independent, so running
+  // each one over the block is equivalent to per-sample update() calls.
+  void processBlock(int i, std::span<float> out) {
+    float y = values_[i];
+    float c = curved_[i];
+    State st = states_[i];
+    const EnvCfg& e = env_[i];
+    const size_t n = out.size();
+    size_t k = 0;
+    while (k < n) {
+      switch (st) {
+        case State::Idle: {
+          const float v = c * e.depth;
+          for (; k < n; ++k) out[k] = v;
+        } break;
+
+        case State::Attack:
+          for (; k < n; ++k) {
+            y += e.attack;
+            if (y >= cfg_.peakThresh) {
+              y = 1.0f;
+              st = State::Decay;
+            }
+            c = e.curve.computeAttack(y);
+            y = std::clamp(y, 0.0f, 1.0f);
+            out[k] = c * e.depth;
+            if (st != State::Attack) {
+              ++k;
+              break;
+            }
+          }
+          break;
+
+        case State::Decay:
+          for (; k < n; ++k) {
+            y -= e.decay;
+            if (y <= cfg_.floorThresh) {
+              y = 0.0f;
+              st = State::Idle;
+            }
+            c = e.curve.computeDecay(y);
+            y = std::clamp(y, 0.0f, 1.0f);
+            out[k] = c * e.depth;
+            if (st != State::Decay) {
+              ++k;
+              break;
+            }
+          }
+          break;
+      }
+    }
+    values_[i] = y;
+    curved_[i] = c;
+    states_[i] = st;
+  }
+
   // ------ queries / maintenance ------
   float value(int i) const { return curved_[i] * env_[i].depth; }
   float valueRaw(int i) const { return values_[i]; }  // pre-depth 0..1
   bool isActive(int i) const { return states_[i] != State::Idle; }
+  bool anyActive() const {
+    return std::any_of(states_.begin(), states_.end(),
+                       [](State s) { return s != State::Idle; });
+  }
 
   void resetAll() {
     values_.fill(0.0f);
     states_.fill(State::Idle);
+    curved_.fill(0.0f);
   }
 
   Cfg& cfg() { return cfg_; }
@@ -0,0 +1,106 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+#include <span>
+
+namespace zlkm::mod {
+
+// One modulation route as stored in config. Made of 32-bit words so it can
+// travel through util::ParamQueue.
+struct Route {
+  uint8_t src = 0;      // source index (e.g. an envelope)
+  uint8_t dst = 0;      // destination index, engine-defined
+  uint8_t bipolar = 0;  // source 0..1 taken as -1..1
+  uint8_t enabled = 0;
+  float depth = 0.f;  // in the destination's units (semitones, octaves, ...)
+};
+
+// Static modulation matrix between SRC per-sample sources and DST
+// destinations, for up to MAX_ROUTES routes.
+//
+// compile() turns the route table into per-destination runs of
+// {source, scale} with the bipolar offsets folded into one constant, so
+// evaluation is a multiply-add per route and sample with no branches.
+// Destinations without routes are never touched: the engine checks
+// routed() and keeps its unmodulated path, so an empty matrix costs
+// nothing. What the sum means (linear amount, semitones, octaves of
+// cutoff) is up to the destination.
+template <int SRC, int DST, int MAX_ROUTES = 16>
+class ModMatrix {
+ public:
+  template <size_t R>
+  void compile(const std::array<Route, R>& routes) {
+    static_assert(R <= size_t(MAX_ROUTES), "route table larger than matrix");
+    count_.fill(0);
+    offset_.fill(0.f);
+    for (const Route& r : routes) {
+      if (valid_(r)) ++count_[r.dst];
+    }
+    int at = 0;
+    for (int d = 0; d < DST; ++d) {
+      first_[d] = uint8_t(at);
+      at += count_[d];
+    }
+    std::array<uint8_t, DST> next = first_;
+    for (const Route& r : routes) {
+      if (!valid_(r)) continue;
+      Slot& s = slots_[next[r.dst]++];
+      s.src = r.src;
+      // bipolar: depth * (2x - 1) = 2 * depth * x - depth
+      s.scale = r.bipolar ? 2.f * r.depth : r.depth;
+      if (r.bipolar) offset_[r.dst] -= r.depth;
+    }
+    total_ = uint8_t(at);
+  }
+
+  bool empty() const { return total_ == 0; }
+  bool routed(int dst) const { return count_[dst] != 0; }
+
+  // out[i] += routes to 'dst' at source frames from + i. 'src' is indexable
+  // by source and each entry has data() (e.g. an array of block buffers).
+  template <class Sources>
+  void add(int dst, const Sources& src, size_t from,
+           std::span<float> out) const {
+    const float off = offset_[dst];
+    if (off != 0.f) {
+      for (float& v : out) v += off;
+    }
+    const Slot* s = &slots_[first_[dst]];
+    for (const Slot* end = s + count_[dst]; s != end; ++s) {
+      const float* in = src[s->src].data() + from;
+      const float k = s->scale;
+      for (size_t i = 0; i < out.size(); ++i) out[i] += k * in[i];
+    }
+  }
+
+  // Routes to 'dst' at one frame, for destinations updated per sub-block
+  template <class Sources>
+  float at(int dst, const Sources& src, size_t frame) const {
+    float v = offset_[dst];
+    const Slot* s = &slots_[first_[dst]];
+    for (const Slot* end = s + count_[dst]; s != end; ++s) {
+      v += s->scale * src[s->src][frame];
+    }
+    return v;
+  }
+
+ private:
+  struct Slot {
+    uint8_t src = 0;
+    float scale = 0.f;
+  };
+
+  static bool valid_(const Route& r) {
+    return r.enabled && r.src < SRC && r.dst < DST && r.depth != 0.f;
+  }
+
+  std::array<Slot, MAX_ROUTES> slots_{};
+  std::array<uint8_t, DST> first_{};
+  std::array<uint8_t, DST> count_{};
+  std::array<float, DST> offset_{};
+  uint8_t total_ = 0;
+};
+
+}  // namespace zlkm::mod
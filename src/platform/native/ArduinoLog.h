@@ -0,0 +1,72 @@
+#pragma once
+
+// Host stand-in for thijse/ArduinoLog. Only the calls used in this tree are
+// provided; everything is forwarded to stdout via printf-style formatting.
+
+#include <stdarg.h>
+#include <stdio.h>
+
+#ifndef F
+#define F(s) (s)
+#endif
+#ifndef CR
+#define CR "\n"
+#endif
+
+#define LOG_LEVEL_SILENT 0
+#define LOG_LEVEL_FATAL 1
+#define LOG_LEVEL_ERROR 2
+#define LOG_LEVEL_WARNING 3
+#define LOG_LEVEL_NOTICE 4
+#define LOG_LEVEL_TRACE 5
+#define LOG_LEVEL_VERBOSE 6
+
+// One printf-forwarding method per ArduinoLog entry point
+#define _ZLKM_FAKELOG_FN(NAME, LEVEL, NEWLINE) \
+  void NAME(const char* fmt, ...) {            \
+    va_list args;                              \
+    va_start(args, fmt);                       \
+    print_(LEVEL, NEWLINE, fmt, args);         \
+    va_end(args);                              \
+  }
+
+namespace zlkm::platform::native {
+
+class FakeLog {
+ public:
+  template <class Out>
+  void begin(int level, Out*) {
+    level_ = level;
+  }
+  void setLevel(int level) { level_ = level; }
+
+  _ZLKM_FAKELOG_FN(fatal, LOG_LEVEL_FATAL, false)
+  _ZLKM_FAKELOG_FN(fatalln, LOG_LEVEL_FATAL, true)
+  _ZLKM_FAKELOG_FN(error, LOG_LEVEL_ERROR, false)
+  _ZLKM_FAKELOG_FN(errorln, LOG_LEVEL_ERROR, true)
+  _ZLKM_FAKELOG_FN(warning, LOG_LEVEL_WARNING, false)
+  _ZLKM_FAKELOG_FN(warningln, LOG_LEVEL_WARNING, true)
+  _ZLKM_FAKELOG_FN(notice, LOG_LEVEL_NOTICE, false)
+  _ZLKM_FAKELOG_FN(noticeln, LOG_LEVEL_NOTICE, true)
+  _ZLKM_FAKELOG_FN(info, LOG_LEVEL_NOTICE, false)
+  _ZLKM_FAKELOG_FN(infoln, LOG_LEVEL_NOTICE, true)
+  _ZLKM_FAKELOG_FN(trace, LOG_LEVEL_TRACE, false)
+  _ZLKM_FAKELOG_FN(traceln, LOG_LEVEL_TRACE, true)
+  _ZLKM_FAKELOG_FN(verbose, LOG_LEVEL_VERBOSE, false)
+  _ZLKM_FAKELOG_FN(verboseln, LOG_LEVEL_VERBOSE, true)
+
+ private:
+  void print_(int level, bool newline, const char* fmt, va_list args) {
+    if (level > level_) return;
+    vprintf(fmt, args);
+    if (newline) putchar('\n');
+  }
+
+  int level_ = LOG_LEVEL_NOTICE;
+};
+
+}  // namespace zlkm::platform::native
+
+#undef _ZLKM_FAKELOG_FN
+
+inline ::zlkm::platform::native::FakeLog Log;
@@ -0,0 +1,52 @@
+#pragma once
+
+// Host stand-in for pschatzmann/arduino-audio-tools. Provides just enough of
+// the I2S surface used by I2SSink so audio code builds off-device; the DMA
+// ring always reads as drained and writes are accepted in full and discarded.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ArduinoLog.h"
+#include "Stream.h"
+
+namespace audio_tools {
+
+enum RxTxMode { UNDEFINED_MODE = 0, TX_MODE = 1, RX_MODE = 2, RXTX_MODE = 3 };
+
+struct I2SConfig {
+  RxTxMode rx_tx_mode = TX_MODE;
+  int sample_rate = 44100;
+  int channels = 2;
+  int bits_per_sample = 16;
+  int pin_bck = -1;
+  int pin_ws = -1;
+  int pin_data = -1;
+  int buffer_count = 6;
+  int buffer_size = 512;
+};
+
+class I2SStream : public Stream {
+ public:
+  I2SConfig defaultConfig(RxTxMode mode = TX_MODE) {
+    I2SConfig cfg;
+    cfg.rx_tx_mode = mode;
+    return cfg;
+  }
+
+  bool begin(const I2SConfig& cfg) {
+    cfg_ = cfg;
+    return true;
+  }
+  void end() {}
+
+  int availableForWrite() { return cfg_.buffer_count * cfg_.buffer_size; }
+  size_t write(const uint8_t*, size_t len) { return len; }
+
+ private:
+  I2SConfig cfg_;
+};
+
+}  // namespace audio_tools
+
+using namespace audio_tools;
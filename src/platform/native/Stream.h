@@ -0,0 +1,8 @@
+#pragma once
+
+// Host stand-in for the Arduino Stream base class.
+
+class Stream {
+ public:
+  virtual ~Stream() = default;
+};
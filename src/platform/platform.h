@@ -57,4 +57,10 @@ static inline uint32_t micros() {
              steady_clock::now().time_since_epoch())
       .count();
 }
+static inline void tight_loop_contents() {}
+static inline void noInterrupts() {}
+// Log for the profiler and audio code; a host stand-in is in platform/native
+#if __has_include(<ArduinoLog.h>)
+#include <ArduinoLog.h>
+#endif
 #endif
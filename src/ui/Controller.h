@@ -11,19 +11,22 @@
 #include "ui/TabControl.h"
 #include "ui/UiTypes.h"
 #include "util/IdleTimer.h"
+#include "util/ParamQueue.h"
 #include "util/Profiler.h"
 
 namespace zlkm::ui {
 
 // Sampler is any type that provides consumeDeltaCounts(int)
-// Controller consumes encoder deltas and updates Calcis::Cfg
+// Controller consumes encoder deltas and updates the kit's Cfg; every edit
+// bumps its section version and is reported to the audio-bound queue
 template <typename SamplerT, size_t N, size_t PAGE_COUNT, size_t ROTARY_COUNT>
 class Controller {
  public:
   using TR = zlkm::ch::CalcisTR;
-  using Calcis = zlkm::ch::Calcis;
-  using Cfg = typename Calcis::Cfg;
-  using Feedback = typename Calcis::Feedback;
+  using Kit = zlkm::ch::Kit;
+  using Cfg = typename Kit::Cfg;
+  using Feedback = typename Kit::Feedback;
+  using Params = zlkm::util::SplitParamQueue<Cfg>;
   using Selection = ParameterTabControlT<N, PAGE_COUNT, ROTARY_COUNT>;
   using PPage = ::zlkm::ui::ParameterPageT<ROTARY_COUNT>;
   using PTab = ::zlkm::ui::ParameterTabT<PAGE_COUNT, ROTARY_COUNT>;
@@ -33,15 +36,21 @@ class Controller {
 
   static constexpr int kAdcMaxCode = 4095;
 
-  Controller(Cfg& cfg, const typename TabButtons::Cfg& buttonCfg, Feedback& fb,
+  Controller(Cfg& cfg, Params& params,
+             const typename TabButtons::Cfg& buttonCfg, Feedback& fb,
              SamplerT& sampler, Selection& selection,
              const typename TriggerBtnMgr::Cfg& triggerBtnCfg)
       : cfg_(cfg),
+        params_(params),
         fb_(fb),
         sampler_(sampler),
         selection_(selection),
         tabBtns_(sampler_.device(), buttonCfg),
-        triggerBtn_(sampler_.device(), triggerBtnCfg) {}
+        triggerBtn_(sampler_.device(), triggerBtnCfg),
+        trigCounter_(&cfg.hot.inst[0].trigCounter) {}
+
+  // The trigger button hits the instrument owning this counter
+  void setTriggerCounter(int* counter) { trigCounter_ = counter; }
 
   // Optional accessor to the externally-owned selection
   Selection& selection() { return selection_; }
@@ -75,7 +84,8 @@ class Controller {
 
     if (consumeTriggerRising()) {
       idle.noteActivity();
-      ++(cfg_.trigCounter);
+      ++*trigCounter_;
+      edited_(trigCounter_, sizeof(*trigCounter_));
     }
 
     // Process encoders for the current page only
@@ -92,7 +102,9 @@ class Controller {
       const float scale = float(kAdcMaxCode) / float(defaultSpan);
       int deltaRaw = int(lroundf(float(dCounts) * scale));
       raw = zlkm::math::clamp(raw + deltaRaw, 0, kAdcMaxCode);
-      page.mappers[i].mapAndSet(raw);
+      auto& m = page.mappers[i];
+      m.mapAndSet(raw);
+      edited_(m.written().ptr, m.written().bytes);
     }
   }
 
@@ -110,6 +122,18 @@ class Controller {
   }
 
  private:
+  // Publish an edit of cfg_: the field first, then its section version, so
+  // the audio side never sees the bump without the new value
+  void edited_(const void* field, size_t bytes) {
+    // UI-side settings (which instrument is edited) stay on this core
+    if (!Kit::Inst::within(field, cfg_)) return;
+    params_.changed(cfg_, field, bytes);
+    if (uint32_t* v = cfg_.sectionVersion(field)) {
+      ++*v;
+      params_.changed(cfg_, v, sizeof(*v));
+    }
+  }
+
   // Access current raw value (for UI display)
   int rawAt(uint8_t tabIdx, uint8_t pageIdx, int ctl) const {
     if (tabIdx >= Selection::count()) return 0;
@@ -120,6 +144,7 @@ class Controller {
 
  private:
   Cfg& cfg_;
+  Params& params_;
   Feedback& fb_;
   SamplerT& sampler_;
   Selection& selection_;
@@ -128,6 +153,7 @@ class Controller {
   // Expander-backed IO
   TabButtons tabBtns_;
   TriggerBtnMgr triggerBtn_;
+  int* trigCounter_;
   bool activity_ = false;
 };
 
@@ -3,6 +3,9 @@
 #include <assert.h>
 #include <math.h>
 
+#include <type_traits>
+
+#include "app/params/Spec.h"
 #include "audio/DJFilter.h"
 #include "dsp/Util.h"
 #include "mod/ADEnvelopes.h"
@@ -17,10 +20,19 @@ class InputMapper {
   using RevMapFuncRaw = RawValue (*)(ValueToSetRaw);
   static const RawValue kMaxRawValue = 4095;
 
+  // Memory a mapAndSet() may modify (for change propagation)
+  struct Written {
+    const void* ptr = nullptr;
+    size_t bytes = 0;
+  };
+
   InputMapper() = default;
   InputMapper(MapAndSetFuncRaw func, RevMapFuncRaw revFunc,
-              ValueToSetRaw valToSet)
-      : mapFunc_(func), revMapFunc_(revFunc), valToSet_(valToSet) {
+              ValueToSetRaw valToSet, Written written)
+      : mapFunc_(func),
+        revMapFunc_(revFunc),
+        valToSet_(valToSet),
+        written_(written) {
     assert(func != nullptr);
     assert(revFunc != nullptr);
     assert(valToSet_ != nullptr);
@@ -28,6 +40,7 @@ class InputMapper {
 
   void mapAndSet(int16_t value) { mapFunc_(value, valToSet_); }
   RawValue reverseMap() const { return revMapFunc_(valToSet_); }
+  const Written& written() const { return written_; }
 
  private:
   static constexpr void noopMap_(RawValue, ValueToSetRaw) { /* no-op */ }
@@ -38,6 +51,7 @@ class InputMapper {
   MapAndSetFuncRaw mapFunc_ = noopMap_;
   RevMapFuncRaw revMapFunc_ = noopRevMap_;
   ValueToSetRaw valToSet_ = nullptr;
+  Written written_{};
 };
 
 template <class ParamT, class HandlerT>
@@ -46,7 +60,7 @@ class InputMapperMixin {
   using IM = InputMapper;
   // Factory: pass a pointer to the target parameter to receive mapped value
   static IM make(ParamT* target) {
-    return IM(&mapFunc_, reverseMapFunc_, target);
+    return IM(&mapFunc_, reverseMapFunc_, target, {target, sizeof(ParamT)});
   }
 
  private:
@@ -210,6 +224,54 @@ class BoolMapper : public InputMapperMixin<bool, BoolMapper<Thr>> {
   }
 };
 
+// Mapper from the ParamSpec registry: knob 0..1 (sticky ends) -> spec
+// domain -> Store -> field. Power/Octave curves read a precomputed table
+// instead of calling powf per tick. Step specs fill int, enum or bool
+// fields.
+template <class Reg, app::params::Id ID, class T = float,
+          class Store = app::params::AsIs>
+class SpecMapper
+    : public InputMapperMixin<T, SpecMapper<Reg, ID, T, Store>> {
+  using IM = InputMapper;
+  using Curve = app::params::Curve;
+
+  static constexpr const app::params::Spec& spec() { return Reg::get(ID); }
+  static constexpr bool kTabled =
+      spec().curve == Curve::Power || spec().curve == Curve::Octave;
+
+ public:
+  static void mapAndSet(int16_t raw, T& out) {
+    const float x = stickEnds(float(raw) / float(IM::kMaxRawValue));
+    float v;
+    if constexpr (kTabled) {
+      v = table_(x);
+    } else {
+      v = spec().toDomain(x);
+    }
+    if constexpr (std::is_same_v<T, bool>) {
+      out = v >= .5f;
+    } else if constexpr (std::is_integral_v<T> || std::is_enum_v<T>) {
+      out = T(int(v));
+    } else {
+      out = Store::store(v);
+    }
+  }
+
+  static int16_t reverseMap(const T& in) {
+    float v;
+    if constexpr (std::is_floating_point_v<T>) {
+      v = Store::load(in);
+    } else {
+      v = float(in);
+    }
+    const float x = invStickEnds(spec().fromDomain(v));
+    return int16_t(x * float(IM::kMaxRawValue));
+  }
+
+ private:
+  static inline const app::params::Table<> table_{spec()};
+};
+
 template <int SR>
 struct FilterMapper {
   using IM = InputMapper;
@@ -260,7 +322,7 @@ struct FilterMapper {
           float v = ParamSetter::get(*reinterpret_cast<ParamT*>(params));
           return int16_t((v * float(IM::kMaxRawValue)));
         },
-        &target);
+        &target, {target.cfg(), sizeof(*target.cfg())});
   }
 };
 
@@ -279,7 +341,7 @@ struct EnvCurveMapper {
           auto* curve = reinterpret_cast<EnvCurve*>(p);
           return int16_t((curve->getCurve01() * float(IM::kMaxRawValue)));
         },
-        &e.curve);
+        &e.curve, {&e.curve, sizeof(e.curve)});
   }
 };
 }  // namespace zlkm::ui
@@ -8,8 +8,11 @@
 
 #include <array>
 #include <memory>
+#include <utility>
 
 #include "CalcisHumilis.h"
+#include "CalcisKit.h"
+#include "app/params/Spec.h"
 #include "audio/AudioTraits.h"
 #include "dsp/Util.h"
 #include "hw/Screen.h"
@@ -54,12 +57,10 @@ class UI {
   using TrigBtnCfg = TrigButton::Cfg;
 
   struct Cfg {
-    enum Tabs { TabSrc = 0, TabFilter, TabCount };
-
-    mod::EnvCfg& env(int idx) { return pCfg->envs[idx]; }
+    enum Tabs { TabSrc = 0, TabFilter, TabKit, TabCount };
 
     Cfg(const Cfg&) = delete;
-    Cfg(Calcis::Cfg* pCfg_)
+    Cfg(Kit::Cfg* pCfg_)
         : pCfg(pCfg_), tabBtns{.pins = CurBoard::TAB_BUTTONS} {}
 
     static constexpr int kNumTabs = 4;
@@ -68,7 +69,7 @@ class UI {
 
     std::array<uint8_t, kNumTabs> tabPageCount{3, 1, 1, 1};
 
-    Calcis::Cfg* pCfg;
+    Kit::Cfg* pCfg;
 
     float snapMultiplier = 0.0f;
     float activityThresh = 32.f;
@@ -82,115 +83,182 @@ class UI {
 
   static CurBoard::PinSource& pins() { return CurBoard::pins(); }
 
-  explicit UI(Calcis::Cfg* cfg, Calcis::Feedback* fb)
+  using Params = ControllerT::Params;
+
+  UI(Kit::Cfg* cfg, Kit::Feedback* fb, Params* params,
+     Kit::TelemetryRing* telemetry)
       : ucfg_(cfg),
         fb_(fb),
         idleTimer_(ucfg_.screenIdleMs),
         sampler_(pins(),
                  SamplerCfg{.pins = CurBoard::ENCODER, .usePullUp = true}),
         controller_(
-            *ucfg_.pCfg, ucfg_.tabBtns, *fb_, sampler_, selection_,
+            *ucfg_.pCfg, *params, ucfg_.tabBtns, *fb_, sampler_, selection_,
             TrigBtnCfg{.pins = TrigButton::GroupArrayT{CurBoard::TRIG_IN},
                        .activeLow = true,
                        .usePullUp = true,
                        .debounceTicks = 5}),
-        view_(selection_, ViewCfg{.fps = 60, .pCfg = ucfg_.pCfg}, fb_),
-        filterParams_(&ucfg_.pCfg->filter) {
+        view_(selection_,
+              ViewCfg{.fps = 60, .pCfg = ucfg_.pCfg, .instrument = &editInst_},
+              fb_, telemetry),
+        filterParams_(makeFilterParams_(ucfg_.pCfg,
+                                        std::make_index_sequence<kInsts>{})) {
     initSpecs();
     controller_.seedFromCfg();
     initSpecs();
     controller_.seedFromCfg();
+    // filterParams_ derived fresh filter coefficients without a bump
+    ucfg_.pCfg->bumpAll();
     // Move expander-backed buttons/LEDs to Controller; keep expander here
   }
 
   // Legacy UI API: update does UI and also ticks sampler
   void update() {
     ZLKM_PERF_SCOPE("UI update");
+    pollInput();
+    render();
+  }
+
+  // Encoders and buttons; scheduled at ~1 kHz on core 0
+  void pollInput() {
     // Trigger button handled in controller
     sampler_.update();
     controller_.update(idleTimer_);
-    view_.update(idleTimer_);
+    if (editInst_ != boundInst_) bind_();
   }
 
+  // One screen/LED frame; scheduled every frameUs()
+  void render() { view_.update(idleTimer_); }
+  uint32_t frameUs() const { return view_.frameUs(); }
+
  private:
-  static constexpr float cycles(float p) { return Calcis::cycles(p); }
+  static constexpr int kInsts = Kit::size();
+  using Specs = app::params::Registry<CH, audio::DJFilterLimitsDefault,
+                                      kInsts, Kit::kChokeGroups>;
+  using FilterParams = audio::SafeFilterParams<CH::INTERNAL_SR>;
+
+  template <size_t... I>
+  static std::array<FilterParams, kInsts> makeFilterParams_(
+      Kit::Cfg* cfg, std::index_sequence<I...>) {
+    return {FilterParams(&cfg->hot.inst[I].filter)...};
+  }
+
+  // The INST knob moved: point the Source and Filter tabs and the trigger
+  // button at the newly selected instrument
+  void bind_() {
+    boundInst_ = editInst_;
+    initSpecs();
+    controller_.seedFromCfg();
+    controller_.setTriggerCounter(&ucfg_.pCfg->hot.inst[editInst_].trigCounter);
+  }
+
+  // Knob mapper for a registry parameter stored through 'Store'
+  template <app::params::Id ID, class Store = app::params::AsIs, class T>
+  static ::zlkm::ui::InputMapper spec(T* field) {
+    return ::zlkm::ui::SpecMapper<Specs, ID, T, Store>::make(field);
+  }
+
   // Selection (tabs/pages) used by both controller and view
   void initSpecs() {
     using PPage = ::zlkm::ui::ParameterPageT<kRotaryCount>;
     using namespace zlkm::ui;
+    using namespace app::params;
 
     static constexpr int SR = CalcisTR::SR;
+    using Hz = Cycles<SR>;
+    using Ms = Rate<SR>;
+    // Source and Filter edit the selected instrument; rebinding keeps the
+    // page the user is on
+    InstView cfg{ucfg_.pCfg->hot.inst[editInst_],
+                 ucfg_.pCfg->cold.inst[editInst_]};
     // Tab 0: Source
     auto& t0 = selection_.tabs[0];
     t0.pageCount = 4;
-    t0.currentPage = 0;
     // Page 0
     {
       auto& p0 = t0.pages[0];
-      auto& cfg = *ucfg_.pCfg;
       // Labels (const char*, no allocations)
       p0.labels = {"PIT", "ADEC", "PDEC", "VOL"};
-      p0.mappers[0] = ZLKM_UI_LIN_FMAPPER(cycles(65.f), cycles(260.f),
-                                          &cfg.cyclesPerSample);
-      p0.mappers[1] =
-          ZLKM_UI_RATE_FMAPPER(20.f, 2000.f, SR, &cfg.envs[CH::EnvAmp].decay);
-      p0.mappers[2] =
-          ZLKM_UI_RATE_FMAPPER(2.f, 80.f, SR, &cfg.envs[CH::EnvPitch].decay);
-      p0.mappers[3] = ZLKM_UI_LIN_FMAPPER(0.f, 1.f, &cfg.outGain);
+      p0.mappers[0] = spec<Pitch, Hz>(&cfg.hot.cyclesPerSample);
+      p0.mappers[1] = spec<AmpDecay, Ms>(&cfg.cold.envs[CH::EnvAmp].decay);
+      p0.mappers[2] = spec<PitchDecay, Ms>(&cfg.cold.envs[CH::EnvPitch].decay);
+      p0.mappers[3] = spec<Volume>(&cfg.hot.outGain);
     }
     // Page 1
     {
       auto& p1 = t0.pages[1];
-      auto& sw = ucfg_.pCfg->swarmOsc;
+      auto& sw = cfg.hot.swarmOsc;
       p1.labels = {"PW", "MRPH", "DET", "SPRD"};
-      p1.mappers[0] = ZLKM_UI_LIN_FMAPPER(0.01f, 0.99f, &sw.pulseWidth);
-      p1.mappers[1] = ZLKM_UI_LIN_FMAPPER(0.f, 1.f, &sw.morph);
-      p1.mappers[2] = ZLKM_UI_LIN_FMAPPER(1.f, 1.05946f, &sw.detuneMul);
-      p1.mappers[3] = ZLKM_UI_LIN_FMAPPER(0.f, 1.f, &sw.stereoSpread);
+      p1.mappers[0] = spec<PulseWidth>(&sw.pulseWidth);
+      p1.mappers[1] = spec<Morph>(&sw.morph);
+      p1.mappers[2] = spec<Detune>(&sw.detuneMul);
+      p1.mappers[3] = spec<Spread>(&sw.stereoSpread);
     }
     // Page 2
     {
       auto& p2 = t0.pages[2];
-      auto& sw = ucfg_.pCfg->swarmOsc;
-      p2.labels = {"UNI", "MMOD", "RPHS", ""};
-      p2.mappers[0] = ZLKM_UI_INT_MAPPER(1.f, CH::MAX_SWARM_VOICES, &sw.voices);
-      p2.mappers[1] = ZLKM_UI_INT_MAPPER(0.f, 1.f, &sw.morphMode);
-      p2.mappers[2] = ZLKM_UI_BOOL_MAPPER(&sw.randomPhase);
+      auto& sw = cfg.hot.swarmOsc;
+      p2.labels = {"UNI", "MMOD", "RPHS", "ENG"};
+      p2.mappers[0] = spec<Voices>(&sw.voices);
+      p2.mappers[1] = spec<MorphMode>(&sw.morphMode);
+      p2.mappers[2] = spec<RandomPhase>(&sw.randomPhase);
+      p2.mappers[3] = spec<EngineSel>(&cfg.cold.oscMode);
     }
 
     // Page 3: Amp Envelope (Attack/Decay/Depth/Curve)
     {
       auto& p3 = t0.pages[3];
-      auto& cfg = *ucfg_.pCfg;
       p3.labels = {"ATK", "DEC", "DEP", "CURV"};
-      auto& envAmp = cfg.envs[CH::EnvAmp];
-      p3.mappers[0] = ZLKM_UI_RATE_FMAPPER(1.f, 1000.f, SR, &envAmp.attack);
-      p3.mappers[1] = ZLKM_UI_RATE_FMAPPER(20.f, 2000.f, SR, &envAmp.decay);
-      p3.mappers[2] = ZLKM_UI_LIN_FMAPPER(0.f, 1.f, &envAmp.depth);
+      auto& envAmp = cfg.cold.envs[CH::EnvAmp];
+      p3.mappers[0] = spec<AmpAttack, Ms>(&envAmp.attack);
+      p3.mappers[1] = spec<AmpDecay, Ms>(&envAmp.decay);
+      p3.mappers[2] = spec<AmpDepth>(&envAmp.depth);
       p3.mappers[3] = EnvCurveMapper::make(envAmp);
     }
 
     // Tab 1: Filter
     auto& t1 = selection_.tabs[1];
     t1.pageCount = 1;
-    t1.currentPage = 0;
     {
       auto& p = t1.pages[0];
-      using MyFilterMapper = ::zlkm::ui::FilterMapper<SR>;
+      auto& fp = filterParams_[editInst_];
+      using MyFilterMapper = ::zlkm::ui::FilterMapper<CH::INTERNAL_SR>;
       p.labels = {"RES", "CUT", "MRPH", "DRV"};
-      p.mappers[0] = MyFilterMapper::makeResonance(filterParams_);
-      p.mappers[1] = MyFilterMapper::makeCutoff(filterParams_);
-      p.mappers[2] = MyFilterMapper::makeMorph(filterParams_);
-      p.mappers[3] = MyFilterMapper::makeDrive(filterParams_);
+      p.mappers[0] = MyFilterMapper::makeResonance(fp);
+      p.mappers[1] = MyFilterMapper::makeCutoff(fp);
+      p.mappers[2] = MyFilterMapper::makeMorph(fp);
+      p.mappers[3] = MyFilterMapper::makeDrive(fp);
+    }
+
+    // Tab 2: Kit. INST picks the instrument the other tabs edit.
+    auto& t2 = selection_.tabs[2];
+    t2.pageCount = 1;
+    {
+      auto& p = t2.pages[0];
+      auto& kit = *ucfg_.pCfg;
+      p.labels = {"INST", "GAIN", "PAN", "CHOK"};
+      p.mappers[0] = spec<Instrument>(&editInst_);
+      p.mappers[1] = spec<MixGain>(&kit.hot.gain[editInst_]);
+      p.mappers[2] = spec<MixPan>(&kit.hot.pan[editInst_]);
+      p.mappers[3] = spec<Choke>(&kit.cold.choke[editInst_]);
     }
   }
 
+  // One instrument's sections, named like Calcis::Cfg's
+  struct InstView {
+    Calcis::Cfg::Hot& hot;
+    Calcis::Cfg::Cold& cold;
+  };
+
   Cfg ucfg_;
-  Calcis::Feedback* fb_{};
+  Kit::Feedback* fb_{};
   zlkm::util::IdleTimer idleTimer_{10000};
 
+  int editInst_ = 0;   // instrument the Source/Filter tabs edit
+  int boundInst_ = 0;  // the one their mappers point at
+
   // Pin source reference
-  audio::SafeFilterParams<CalcisTR::SR> filterParams_;
+  std::array<FilterParams, kInsts> filterParams_;
 
   // Components
   Selection selection_;
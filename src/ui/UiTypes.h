@@ -3,6 +3,7 @@
 #include <array>
 
 #include "CalcisHumilis.h"
+#include "CalcisKit.h"
 #include "audio/AudioTraits.h"
 #include "hw/Screen.h"
 #include "hw/io/ButtonManager.h"
@@ -12,6 +13,11 @@ namespace zlkm::ch {
 
 using CalcisTR = audio::AudioTraits<48000, 1, 32, 64>;
 using Calcis = ch::CalcisHumilis<CalcisTR>;
+// What the board runs: kick, snare and hat, edited one at a time
+static constexpr int kKitSize = 3;
+template <class TR>
+using KitT = ch::CalcisKit<TR, kKitSize>;
+using Kit = KitT<CalcisTR>;
 using ScreenSSD = hw::Screen<platform::boards::Current::SCREEN_CTRL>;
 
 // Convenience aliases used by UI components (kept minimal here)
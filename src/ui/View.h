@@ -2,6 +2,7 @@
 
 #include <JLED.h>
 #include <U8g2lib.h>
+#include <math.h>
 
 #include <array>
 
@@ -31,8 +32,10 @@ class View {
   using SaverCfg = typename ScreenSavers::Cfg;
   using Calcis = zlkm::ch::Calcis;
   using CalcisTR = zlkm::ch::CalcisTR;
-  using CalcisCfg = zlkm::ch::Calcis::Cfg;
-  using Feedback = typename Calcis::Feedback;
+  using Kit = zlkm::ch::Kit;
+  using KitCfg = typename Kit::Cfg;
+  using Feedback = typename Kit::Feedback;
+  using TelemetryRing = typename Kit::TelemetryRing;
 
   static Pin::ValueType getPin(const Pin& pin) {
     return zlkm::hw::io::getPin(pin).value;
@@ -40,41 +43,46 @@ class View {
 
   struct Cfg {
     uint32_t fps = 60;
-    CalcisCfg* pCfg = nullptr;
+    KitCfg* pCfg = nullptr;
+    const int* instrument = nullptr;  // the one being edited, for the title
   };
 
   static CurBoard::PinSource& pins() { return CurBoard::pins(); }
 
-  View(Selection& selection, const Cfg& cfg, Feedback* fb)
+  View(Selection& selection, const Cfg& cfg, Feedback* fb,
+       TelemetryRing* telemetry = nullptr)
       : screen_({}),
         selection_(selection),
         cfg_(cfg),
         saver_(SaverCfg()),
         triggerLED_(getPin(CurBoard::LED_TRIGGER)),
         clippingLED_(getPin(CurBoard::LED_CLIPPING)),
-        fb_(fb) {
+        fb_(fb),
+        telemetry_(telemetry) {
     assert(cfg_.pCfg != nullptr && "View requires valid Calcis config");
 
     pins().setPinsMode(CurBoard::LEDS, zlkm::hw::io::PinMode::Output);
     pins().writePins(CurBoard::LEDS, false);
     // Construct button manager on the expander
     updateTabLEDs_();
-    lastUpdateMs_ = millis();
-    updateInterval_ = 1000 / (cfg_.fps ? cfg_.fps : 60);
   }
 
-  // Call on UI core at free cadence; internally gated to ~fps
+  // Frame period for the caller's scheduler
+  uint32_t frameUs() const { return 1000000u / (cfg_.fps ? cfg_.fps : 60); }
+
+  // Draws one frame; the caller paces it at frameUs()
   void update(const zlkm::util::IdleTimer& idle) {
     ZLKM_PERF_SCOPE("View::update");
     const uint32_t now = millis();
-    if (now - lastUpdateMs_ < updateInterval_) return;
-    lastUpdateMs_ = now;
+    drainTelemetry_();
 
     using namespace zlkm::dsp;
-    if (cfg_.pCfg->trigCounter != lastTrigCounter_) {
-      lastTrigCounter_ = cfg_.pCfg->trigCounter;
-      const uint16_t fadeMs =
-          rateToMs(cfg_.pCfg->envs[Calcis::EnvAmp].decay, CalcisTR::SR);
+    for (int i = 0; i < Kit::size(); ++i) {
+      const int tc = cfg_.pCfg->hot.inst[i].trigCounter;
+      if (tc == lastTrigCounter_[i]) continue;
+      lastTrigCounter_[i] = tc;
+      const uint16_t fadeMs = rateToMs(
+          cfg_.pCfg->cold.inst[i].envs[Calcis::EnvAmp].decay, CalcisTR::SR);
       triggerLED_.FadeOff(fadeMs);
     }
 
@@ -123,7 +131,11 @@ class View {
 
         // Text and page info, kept above the ring row
         g.setFont(u8g2_font_5x8_tf);
-        const char* title = "CalcisHumilis";
+        std::array<char, 24> title{"CalcisHumilis"};
+        if (cfg_.instrument) {
+          snprintf(title.data(), title.size(), "CalcisHumilis %d/%d",
+                   *cfg_.instrument + 1, Kit::size());
+        }
         std::array<char, 64> buf{};
         const uint8_t tabTotal = Selection::count();
         const uint8_t pageTotal = selection_.currentTabPageCount();
@@ -155,14 +167,41 @@ class View {
           yInfo += delta;
           // yLabel stays relative to rings to preserve spacing
         }
-        int tw = g.getStrWidth(title);
-        g.drawStr((w - tw) / 2, yTitle, title);
+        int tw = g.getStrWidth(title.data());
+        g.drawStr((w - tw) / 2, yTitle, title.data());
+
+        // 4) Output peak meters along the left/right edges
+        if (telemetry_) {
+          const int ml = meterHeight_(peak_[0], h);
+          const int mr = meterHeight_(peak_[1], h);
+          g.drawBox(0, h - ml, 2, ml);
+          g.drawBox(w - 2, h - mr, 2, mr);
+        }
       });
     }
     tickLED_();
   }
 
  private:
+  // Keep the highest peak of all records since the last frame
+  void drainTelemetry_() {
+    if (!telemetry_) return;
+    peak_ = {0.f, 0.f};
+    while (const auto* t = telemetry_->peek()) {
+      peak_[0] = fmaxf(peak_[0], t->peak[0]);
+      peak_[1] = fmaxf(peak_[1], t->peak[1]);
+      telemetry_->pop();
+    }
+  }
+
+  // -48..0 dBFS onto 0..h pixels
+  static int meterHeight_(float peak, int h) {
+    static constexpr float kFloorDb = -48.f;
+    if (peak <= 0.f) return 0;
+    const float db = fmaxf(20.f * log10f(peak), kFloorDb);
+    return int(float(h) * (1.f - db / kFloorDb));
+  }
+
   void updateTabLEDs_() {
     const uint8_t activeTab = selection_.currentTabIndex();
     for (uint8_t i = 0; i < 4; ++i) {
@@ -181,6 +220,13 @@ class View {
       clippingLED_.FadeOff(80);
       saturationCounter_ = fb_->saturationCounter;
     }
+    if (fb_ && (underruns_ != fb_->underruns ||
+                nearMisses_ != fb_->nearMisses)) {
+      underruns_ = fb_->underruns;
+      nearMisses_ = fb_->nearMisses;
+      Log.warning(F("[Audio] underruns=%u near misses=%u" CR),
+                  unsigned(underruns_), unsigned(nearMisses_));
+    }
   }
 
   // Procedural ring renderer removed in favor of precomputed bitmaps
@@ -189,15 +235,18 @@ class View {
   Selection& selection_;
   ScreenSavers saver_;
   Cfg cfg_{};
-  uint32_t lastUpdateMs_ = 0;
-  uint32_t updateInterval_ = 0;
   // Moved from UI: LEDs
   JLed triggerLED_;
   JLed clippingLED_;
   // Optional feedback for clipping detection
   Feedback* fb_{};
   int saturationCounter_ = 0;
-  int lastTrigCounter_ = 0;
+  uint32_t underruns_ = 0;
+  uint32_t nearMisses_ = 0;
+  // Optional audio telemetry for the meters
+  TelemetryRing* telemetry_{};
+  std::array<float, 2> peak_{};
+  std::array<int, Kit::size()> lastTrigCounter_{};
 };
 
 }  // namespace zlkm::ui
@@ -0,0 +1,153 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <array>
+#include <type_traits>
+
+#include "util/SpscQueue.h"
+#include "util/TripleBuffer.h"
+
+namespace zlkm::util {
+
+// Change-only transfer of a config struct T between two cores.
+//
+// The writer edits its own T and reports each edited field; the field's
+// 32-bit words go through an SPSC queue as {paramId, value} events, where
+// paramId is the word index within T. The reader applies them to its own
+// copy, so the per-block cost scales with what moved, not with sizeof(T).
+//
+// If the queue is full (or a field is too large) the writer stops queuing
+// and flush() publishes a full snapshot through a triple buffer instead.
+// Snapshots carry an epoch and so does every event: the reader drops events
+// older than the snapshot it holds and defers newer ones until it has
+// picked up their snapshot, so both paths apply in program order.
+template <class T, size_t CAP = 64>
+class ParamQueue {
+  static_assert(std::is_trivially_copyable_v<T>);
+  static_assert(sizeof(T) % 4 == 0 && alignof(T) >= 4,
+                "T must be made of 32-bit words");
+  static constexpr size_t kWords = sizeof(T) / 4;
+  static_assert(kWords <= 0x10000, "T too large for 16-bit param ids");
+
+ public:
+  // Largest field (in words) queued as events; bigger ones force a snapshot
+  static constexpr size_t kMaxFieldWords = 16;
+
+  struct Event {
+    uint16_t param = 0;  // word index in T
+    uint16_t epoch = 0;  // snapshot generation the event builds on
+    uint32_t bits = 0;   // raw word
+  };
+
+  // ---- writer side ----
+  // 'field' (of 'bytes' bytes) lives in 'src', the writer's copy
+  void changed(const T& src, const void* field, size_t bytes) {
+    if (needSnapshot_ || bytes == 0) return;  // flush() will cover it
+    const size_t off = size_t(static_cast<const uint8_t*>(field) -
+                              reinterpret_cast<const uint8_t*>(&src));
+    const size_t first = off / 4, last = (off + bytes - 1) / 4;
+    const size_t n = last - first + 1;
+    if (n > kMaxFieldWords || last >= kWords) {
+      needSnapshot_ = true;
+      return;
+    }
+    std::array<Event, kMaxFieldWords> ev;
+    const auto* words = reinterpret_cast<const uint8_t*>(&src);
+    for (size_t i = 0; i < n; ++i) {
+      ev[i].param = uint16_t(first + i);
+      ev[i].epoch = epoch_;
+      memcpy(&ev[i].bits, words + 4 * (first + i), 4);
+    }
+    if (!events_.push({ev.data(), n})) {
+      ++overflows_;
+      needSnapshot_ = true;
+    }
+  }
+
+  // Full-snapshot fallback; call once per writer pass
+  void flush(const T& src) {
+    if (!needSnapshot_) return;
+    Snapshot& s = snaps_.back();
+    s.value = src;
+    s.epoch = ++epoch_;
+    snaps_.publish();
+    needSnapshot_ = false;
+  }
+
+  uint32_t overflows() const { return overflows_; }
+
+  // ---- reader side ----
+  // Bring 'dst' up to date; call at block start
+  void apply(T& dst) {
+    if (snaps_.update()) {
+      dst = snaps_.front().value;
+      readEpoch_ = snaps_.front().epoch;
+    }
+    auto* words = reinterpret_cast<uint8_t*>(&dst);
+    while (const Event* e = events_.peek()) {
+      const int16_t age = int16_t(readEpoch_ - e->epoch);
+      if (age < 0) break;  // needs a snapshot we have not picked up yet
+      if (age == 0) memcpy(words + 4 * size_t(e->param), &e->bits, 4);
+      events_.pop();
+    }
+  }
+
+ private:
+  struct Snapshot {
+    T value{};
+    uint16_t epoch = 0;
+  };
+
+  SpscQueue<Event, CAP> events_;
+  TripleBuffer<Snapshot> snaps_;
+
+  // writer-owned; start with a snapshot so the reader matches from block 1
+  bool needSnapshot_ = true;
+  uint16_t epoch_ = 0;
+  uint32_t overflows_ = 0;
+
+  uint16_t readEpoch_ = 0;  // reader-owned
+};
+
+// ParamQueue per section of a struct T { Hot hot; Cold cold; }: the hot
+// section (read by every block) and the cold one each get their own events
+// and snapshots, so a cold overflow never copies hot params and vice versa,
+// and growing the cold section leaves the hot snapshot as small as it is.
+template <class T, size_t HOT_CAP = 64, size_t COLD_CAP = 32>
+class SplitParamQueue {
+  using Hot = decltype(T::hot);
+  using Cold = decltype(T::cold);
+
+ public:
+  // ---- writer side ----
+  void changed(const T& src, const void* field, size_t bytes) {
+    const auto* p = static_cast<const uint8_t*>(field);
+    const auto* h = reinterpret_cast<const uint8_t*>(&src.hot);
+    if (p >= h && p < h + sizeof(Hot)) {
+      hot_.changed(src.hot, field, bytes);
+    } else {
+      cold_.changed(src.cold, field, bytes);
+    }
+  }
+
+  void flush(const T& src) {
+    hot_.flush(src.hot);
+    cold_.flush(src.cold);
+  }
+
+  uint32_t overflows() const { return hot_.overflows() + cold_.overflows(); }
+
+  // ---- reader side ----
+  void apply(T& dst) {
+    hot_.apply(dst.hot);
+    cold_.apply(dst.cold);
+  }
+
+ private:
+  ParamQueue<Hot, HOT_CAP> hot_;
+  ParamQueue<Cold, COLD_CAP> cold_;
+};
+
+}  // namespace zlkm::util
@@ -0,0 +1,114 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+
+#include "platform/platform.h"
+
+namespace zlkm::util {
+
+struct MicrosClock {
+  static uint32_t now() { return uint32_t(micros()); }
+};
+
+// Cooperative scheduler over a fixed table of N tasks; no heap, no threads.
+//
+// Each task is released every periodUs and should be done within
+// deadlineUs of its release. runOnce() runs at most one task: of those
+// released, the one closest to its deadline (EDF), so a slow task holds
+// the others up by its own run time only. A task that falls more than a
+// period behind runs once for its latest release; the older ones are
+// dropped (and counted) instead of run back to back.
+template <size_t N, class Clock = MicrosClock>
+class Scheduler {
+ public:
+  using Fn = void (*)(void* ctx);
+
+  struct Task {
+    const char* name = "";
+    Fn fn = nullptr;
+    void* ctx = nullptr;
+    uint32_t periodUs = 0;
+    uint32_t deadlineUs = 0;  // after release; 0: one period
+    uint32_t budgetUs = 0;    // expected worst run time; 0: unchecked
+  };
+
+  struct Stats {
+    uint32_t runs = 0;
+    uint32_t late = 0;        // finished past the deadline
+    uint32_t overBudget = 0;  // ran longer than budgetUs
+    uint32_t skipped = 0;     // releases dropped after falling behind
+    uint32_t maxRunUs = 0;
+    uint32_t maxLatencyUs = 0;  // release to start
+  };
+
+  explicit Scheduler(const std::array<Task, N>& tasks) : tasks_(tasks) {
+    const uint32_t now = Clock::now();
+    for (size_t i = 0; i < N; ++i) {
+      if (!tasks_[i].deadlineUs) tasks_[i].deadlineUs = tasks_[i].periodUs;
+      release_[i] = now;
+    }
+  }
+
+  // Run the most urgent released task, if any. Returns the time until the
+  // next release (0: more work is due now).
+  uint32_t runOnce() {
+    uint32_t now = Clock::now();
+    size_t pick = N;
+    int32_t bestSlack = 0;
+    for (size_t i = 0; i < N; ++i) {
+      if (int32_t(now - release_[i]) < 0) continue;
+      const int32_t slack =
+          int32_t(release_[i] + tasks_[i].deadlineUs - now);
+      if (pick == N || slack < bestSlack) {
+        pick = i;
+        bestSlack = slack;
+      }
+    }
+    if (pick != N) now = run_(pick);
+
+    int32_t wait = INT32_MAX;
+    for (size_t i = 0; i < N; ++i) {
+      const int32_t d = int32_t(release_[i] - now);
+      if (d < wait) wait = d;
+    }
+    return wait > 0 ? uint32_t(wait) : 0;
+  }
+
+  static constexpr size_t size() { return N; }
+  const Task& task(size_t i) const { return tasks_[i]; }
+  const Stats& stats(size_t i) const { return stats_[i]; }
+
+ private:
+  uint32_t run_(size_t i) {
+    const Task& t = tasks_[i];
+    Stats& s = stats_[i];
+    const uint32_t t0 = Clock::now();
+    t.fn(t.ctx);
+    const uint32_t t1 = Clock::now();
+
+    const uint32_t ranUs = t1 - t0;
+    const uint32_t latencyUs = t0 - release_[i];
+    ++s.runs;
+    if (ranUs > s.maxRunUs) s.maxRunUs = ranUs;
+    if (latencyUs > s.maxLatencyUs) s.maxLatencyUs = latencyUs;
+    if (t.budgetUs && ranUs > t.budgetUs) ++s.overBudget;
+    if (t1 - release_[i] > t.deadlineUs) ++s.late;
+
+    release_[i] += t.periodUs;
+    const uint32_t behind = t1 - release_[i];
+    if (int32_t(behind) >= int32_t(t.periodUs)) {
+      const uint32_t missed = behind / t.periodUs;
+      release_[i] += missed * t.periodUs;
+      s.skipped += missed;
+    }
+    return t1;
+  }
+
+  std::array<Task, N> tasks_;
+  std::array<uint32_t, N> release_{};
+  std::array<Stats, N> stats_{};
+};
+
+}  // namespace zlkm::util
@@ -0,0 +1,66 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <span>
+
+namespace zlkm::util {
+
+// Lock-free single-producer/single-consumer ring of CAP trivially copyable
+// items. Head/tail are free-running 32-bit counters (wrap-safe), each
+// written by one side only; items become visible with one release store.
+//
+// Like spin_lock_t, the atomic template can be swapped for platform ones.
+template <class T, size_t CAP, template <class> class Atomic = std::atomic>
+class SpscQueue {
+  static_assert(CAP > 0 && (CAP & (CAP - 1)) == 0,
+                "CAP must be a power of two");
+  static constexpr uint32_t kMask = uint32_t(CAP - 1);
+
+ public:
+  SpscQueue() = default;
+  SpscQueue(const SpscQueue&) = delete;
+  SpscQueue& operator=(const SpscQueue&) = delete;
+
+  static constexpr size_t capacity() { return CAP; }
+
+  // ---- writer side ----
+  size_t writeAvailable() const {
+    const uint32_t t = tail_.load(std::memory_order_acquire);
+    return CAP - size_t(head_.load(std::memory_order_relaxed) - t);
+  }
+
+  bool push(const T& v) { return push(std::span<const T>(&v, 1)); }
+
+  // All or nothing: the reader sees either every item or none of them
+  bool push(std::span<const T> items) {
+    if (items.size() > writeAvailable()) return false;
+    const uint32_t h = head_.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < items.size(); ++i) {
+      buf_[(h + uint32_t(i)) & kMask] = items[i];
+    }
+    head_.store(h + uint32_t(items.size()), std::memory_order_release);
+    return true;
+  }
+
+  // ---- reader side ----
+  // Oldest item or nullptr; stays valid until pop()
+  const T* peek() const {
+    const uint32_t t = tail_.load(std::memory_order_relaxed);
+    if (head_.load(std::memory_order_acquire) == t) return nullptr;
+    return &buf_[t & kMask];
+  }
+
+  void pop() {
+    tail_.store(tail_.load(std::memory_order_relaxed) + 1,
+                std::memory_order_release);
+  }
+
+ private:
+  T buf_[CAP]{};
+  Atomic<uint32_t> head_{0};  // writer-owned
+  Atomic<uint32_t> tail_{0};  // reader-owned
+};
+
+}  // namespace zlkm::util
@@ -0,0 +1,60 @@
+#pragma once
+#include <stdint.h>
+
+#include <atomic>
+
+namespace zlkm::util {
+
+// Wait-free single-producer/single-consumer triple buffer.
+//
+// The writer fills back() and publish()es it; the reader calls update() at
+// a convenient point (e.g. block start) and then reads front() in place.
+// Each side owns one slot, the third sits in the middle; both hand-offs are
+// a single atomic exchange of the middle index, so neither side can ever
+// wait for the other. Values never move: publishing only swaps indices.
+//
+// Like spin_lock_t, the atomic template can be swapped for platform ones.
+template <class T, template <class> class Atomic = std::atomic>
+class TripleBuffer {
+  static constexpr uint8_t kIndexMask = 0x3;
+  static constexpr uint8_t kFresh = 0x4;  // middle holds an unread value
+
+ public:
+  TripleBuffer() = default;
+  explicit TripleBuffer(const T& init) {
+    for (auto& s : slots_) s = init;
+  }
+  TripleBuffer(const TripleBuffer&) = delete;
+  TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+  // ---- writer side ----
+  T& back() { return slots_[back_]; }
+
+  // Hand back() to the reader; back() then points at a recycled slot whose
+  // contents are stale, so writers overwrite it completely
+  void publish() {
+    const uint8_t prev = middle_.exchange(uint8_t(back_ | kFresh),
+                                          std::memory_order_acq_rel);
+    back_ = prev & kIndexMask;
+  }
+
+  // ---- reader side ----
+  // Switch front() to the newest published value; false if there is none
+  bool update() {
+    if (!(middle_.load(std::memory_order_relaxed) & kFresh)) return false;
+    const uint8_t prev =
+        middle_.exchange(front_, std::memory_order_acq_rel);
+    front_ = prev & kIndexMask;
+    return true;
+  }
+
+  const T& front() const { return slots_[front_]; }
+
+ private:
+  T slots_[3]{};
+  uint8_t back_ = 0;   // writer-owned
+  uint8_t front_ = 1;  // reader-owned
+  Atomic<uint8_t> middle_{2};
+};
+
+}  // namespace zlkm::util
@@ -38,6 +38,52 @@ void test_depth_scaling() {
   TEST_ASSERT(env.value(0) <= 0.25f);
 }
 
+void test_process_block_matches_update() {
+  ADEnvelopes<1> a, b;
+  a.setRates(0, 0.05f, 0.01f);
+  b.setRates(0, 0.05f, 0.01f);
+  a.setDepth(0, 0.5f);
+  b.setDepth(0, 0.5f);
+  a.trigger(0);
+  b.trigger(0);
+  std::array<float, 32> blk{};
+  for (int n = 0; n < 16; ++n) {
+    b.processBlock(0, blk);
+    for (float v : blk) {
+      a.update();
+      TEST_ASSERT_FLOAT_WITHIN(1e-7f, a.value(0), v);
+    }
+  }
+  TEST_ASSERT_EQUAL(a.isActive(0), b.isActive(0));
+}
+
+void test_any_active_tracks_all_envelopes() {
+  ADEnvelopes<2> env;
+  env.setRates(0, 1.0f, 1.0f);
+  env.setRates(1, 1.0f, 0.1f);
+  TEST_ASSERT_FALSE(env.anyActive());
+  env.triggerAll();
+  std::array<float, 4> blk{};
+  env.processBlock(0, blk);
+  env.processBlock(1, blk);
+  // Envelope 0 is done after attack + decay, envelope 1 is still decaying
+  TEST_ASSERT_FALSE(env.isActive(0));
+  TEST_ASSERT_TRUE(env.anyActive());
+}
+
+void test_reset_all_idles_at_zero() {
+  ADEnvelopes<1> env;
+  env.setRates(0, 0.5f, 0.01f);
+  env.triggerAll();
+  std::array<float, 8> blk{};
+  env.processBlock(0, blk);
+  TEST_ASSERT_TRUE(env.value(0) > 0.5f);
+  env.resetAll();
+  TEST_ASSERT_FALSE(env.anyActive());
+  env.processBlock(0, blk);
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, blk.back());
+}
+
 }  // namespace ad_tests
 
 void test_ad_envelopes() {
@@ -45,4 +91,7 @@ void test_ad_envelopes() {
   RUN_TEST(test_trigger_and_attack);
   RUN_TEST(test_reaches_decay_and_finishes);
   RUN_TEST(test_depth_scaling);
+  RUN_TEST(test_process_block_matches_update);
+  RUN_TEST(test_any_active_tracks_all_envelopes);
+  RUN_TEST(test_reset_all_idles_at_zero);
 }
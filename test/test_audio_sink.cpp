@@ -0,0 +1,148 @@
+#include <algorithm>
+
+#include "audio/AudioTraits.h"
+#include "audio/sink/ClockedSink.h"
+#include "audio/sink/RingSink.h"
+#include "platform/test.h"
+
+using namespace zlkm::audio;
+
+namespace audio_sink_tests {
+
+// 64 frames at 48 kHz = 1333.33 us per block
+using TR = AudioTraits<48000, 1, 32, 64>;
+using Sink = ClockedSink<TR, 2>;
+
+void test_pulls_only_when_a_slot_frees() {
+  Sink sink;
+  int filled = 0;
+  auto fill = [&](TR::BufferT& b) { b[0] = ++filled; };
+
+  TEST_ASSERT_EQUAL_UINT32(2, sink.service(1000, fill));  // prime the ring
+  TEST_ASSERT_EQUAL_UINT32(0, sink.service(1000, fill));
+  TEST_ASSERT_EQUAL_UINT32(0, sink.service(2333, fill));  // still playing #1
+  TEST_ASSERT_EQUAL_UINT32(1, sink.service(2334, fill));  // #1 done
+  TEST_ASSERT_EQUAL(3, sink.lastBlock()[0]);
+
+  // Deadlines are exact: three blocks = 4000 us, no per-block rounding
+  TEST_ASSERT_EQUAL_UINT32(5000, sink.deadlineUs());
+  TEST_ASSERT_EQUAL_UINT32(0, sink.underruns());
+}
+
+void test_late_service_counts_underrun() {
+  Sink sink;
+  auto fill = [](TR::BufferT&) {};
+  sink.service(0, fill);
+  TEST_ASSERT_EQUAL_UINT32(2666, sink.deadlineUs());
+
+  sink.service(2666, fill);  // just in time
+  TEST_ASSERT_EQUAL_UINT32(0, sink.underruns());
+
+  // Ran dry at 4000 us; the timeline restarts from the late call
+  TEST_ASSERT_EQUAL_UINT32(2, sink.service(4500, fill));
+  TEST_ASSERT_EQUAL_UINT32(1, sink.underruns());
+  TEST_ASSERT_EQUAL_UINT32(4500 + 2666, sink.deadlineUs());
+}
+
+void test_deeper_ring_absorbs_slow_render() {
+  ClockedSink<TR, 4> sink;
+  auto fill = [](TR::BufferT&) {};
+  TEST_ASSERT_EQUAL_UINT32(4, sink.service(0, fill));  // 5333 us queued
+
+  // One render ran three blocks long: the ring covers it, barely
+  TEST_ASSERT_EQUAL_UINT32(3, sink.service(4000, fill));
+  TEST_ASSERT_EQUAL_UINT32(0, sink.underruns());
+  TEST_ASSERT_EQUAL_UINT32(0, sink.nearMisses());
+  TEST_ASSERT_EQUAL_UINT32(3, sink.service(9200, fill));
+  TEST_ASSERT_EQUAL_UINT32(0, sink.underruns());
+  TEST_ASSERT_EQUAL_UINT32(1, sink.nearMisses());  // 133 us to spare
+}
+
+void test_sync_follows_device_fill_level() {
+  BlockClock<TR> clock;
+  clock.queued(0);
+  clock.queued(0);
+  TEST_ASSERT_EQUAL_UINT32(128, clock.aheadFrames(0));
+
+  // Device clock ran slow: both buffers still queued where micros() says
+  // the second is nearly done; pull the timeline back, no false underrun
+  clock.sync(2600, 128);
+  TEST_ASSERT_EQUAL_UINT32(0, clock.underruns());
+  TEST_ASSERT_EQUAL_UINT32(64, clock.aheadFrames(2600));
+
+  clock.sync(2700, 0);  // drained for real
+  TEST_ASSERT_EQUAL_UINT32(1, clock.underruns());
+}
+
+// Device side of a RingSink: 'room' bytes free, writes take at most
+// 'maxWrite' of them
+struct StubStream {
+  int room = 0;
+  int maxWrite = 1 << 30;
+  int written = 0;
+
+  int availableForWrite() { return room; }
+  size_t write(const uint8_t*, size_t len) {
+    const int n = std::min({int(len), room, maxWrite});
+    room -= n;
+    written += n;
+    return size_t(n);
+  }
+};
+
+void test_ring_sink_waits_for_a_whole_block() {
+  constexpr int kBlock = int(TR::BLOCK_BYTES);
+  StubStream dev;
+  RingSink<TR, 2, StubStream> sink(dev);
+  int filled = 0;
+  auto fill = [&](TR::BufferT&) { ++filled; };
+
+  dev.room = 2 * kBlock;
+  TEST_ASSERT_EQUAL_UINT32(1, sink.service(0, fill));
+  TEST_ASSERT_EQUAL_UINT32(1, sink.service(0, fill));
+  TEST_ASSERT_EQUAL_UINT32(2666, sink.deadlineUs());
+
+  // Part of a block drained: nothing rendered, the timeline stays put
+  dev.room = kBlock / 2;
+  TEST_ASSERT_EQUAL_UINT32(0, sink.service(700, fill));
+  TEST_ASSERT_EQUAL(2, filled);
+  TEST_ASSERT_EQUAL_UINT32(2666, sink.deadlineUs());
+
+  dev.room = kBlock;
+  TEST_ASSERT_EQUAL_UINT32(1, sink.service(1334, fill));
+  TEST_ASSERT_EQUAL_UINT32(4000, sink.deadlineUs());
+  TEST_ASSERT_EQUAL(3 * kBlock, dev.written);
+  TEST_ASSERT_EQUAL_UINT32(0, sink.underruns());
+}
+
+void test_ring_sink_finishes_a_short_write_first() {
+  constexpr int kBlock = int(TR::BLOCK_BYTES);
+  StubStream dev;
+  RingSink<TR, 2, StubStream> sink(dev);
+  int filled = 0;
+  auto fill = [&](TR::BufferT&) { ++filled; };
+
+  dev.room = 2 * kBlock;
+  dev.maxWrite = kBlock / 4;
+  TEST_ASSERT_EQUAL_UINT32(1, sink.service(0, fill));
+  // The rest of block 1 goes out before block 2 is rendered
+  TEST_ASSERT_EQUAL_UINT32(0, sink.service(0, fill));
+  TEST_ASSERT_EQUAL_UINT32(0, sink.service(0, fill));
+  TEST_ASSERT_EQUAL(1, filled);
+  TEST_ASSERT_EQUAL(3 * kBlock / 4, dev.written);
+  TEST_ASSERT_EQUAL_UINT32(1, sink.service(0, fill));
+  TEST_ASSERT_EQUAL(2, filled);
+  TEST_ASSERT_EQUAL(kBlock + kBlock / 4, dev.written);
+}
+
+}  // namespace audio_sink_tests
+
+void test_audio_sink() {
+  using namespace audio_sink_tests;
+  RUN_TEST(test_pulls_only_when_a_slot_frees);
+  RUN_TEST(test_late_service_counts_underrun);
+  RUN_TEST(test_deeper_ring_absorbs_slow_render);
+  RUN_TEST(test_sync_follows_device_fill_level);
+  RUN_TEST(test_ring_sink_waits_for_a_whole_block);
+  RUN_TEST(test_ring_sink_finishes_a_short_write_first);
+}
@@ -0,0 +1,247 @@
+#include "platform/test.h"
+// Needs to come first
+
+#include <math.h>
+
+#include <array>
+#include <initializer_list>
+#include <vector>
+
+#include "CalcisHumilis.h"
+#include "audio/AudioTraits.h"
+
+using namespace zlkm;
+
+namespace calcis_tests {
+
+using TR = audio::AudioTraits<48000, 1, 32, 64>;
+using CH = ch::CalcisHumilis<TR>;
+static constexpr int kFrames = TR::BLOCK_FRAMES;
+
+// Short amp envelope and fixed start phases, so runs are short and repeat
+static CH::Cfg shortHit() {
+  CH::Cfg cfg;
+  cfg.hot.swarmOsc.randomPhase = 0;
+  cfg.cold.envs[CH::EnvAmp] = {CH::rate(1.f), CH::rate(15.f)};
+  return cfg;
+}
+
+static audio::Event hitAt(int offset) {
+  audio::Event e;
+  e.offset = uint16_t(offset);
+  return e;
+}
+
+// Left channel of 'blocks' blocks at the internal rate, 'events' in the
+// first; parked blocks (empty spans) as zeros
+template <class Inst>
+static std::vector<float> render(Inst& inst, int blocks,
+                                 std::span<const audio::Event> events = {}) {
+  std::vector<float> out;
+  for (int b = 0; b < blocks; ++b) {
+    const auto blk = inst.renderBlock(b ? std::span<const audio::Event>{}
+                                        : events);
+    if (blk.l.empty()) {
+      out.insert(out.end(), Inst::INTERNAL_FRAMES, 0.f);
+    } else {
+      out.insert(out.end(), blk.l.begin(), blk.l.end());
+    }
+  }
+  return out;
+}
+
+// Left channel of 'blocks' blocks with a hit on each of 'frames'
+// (ascending, absolute output frames)
+template <class Inst>
+static std::vector<float> renderAt(Inst& inst, int blocks,
+                                   std::initializer_list<int> frames) {
+  std::vector<float> out;
+  for (int b = 0; b < blocks; ++b) {
+    std::vector<audio::Event> events;
+    for (int f : frames) {
+      if (f / kFrames == b) events.push_back(hitAt(f - b * kFrames));
+    }
+    const std::vector<float> blk = render(inst, 1, events);
+    out.insert(out.end(), blk.begin(), blk.end());
+  }
+  return out;
+}
+
+// A plain decaying sine, so any jump stands out from its own slope
+static CH::Cfg sineHit() {
+  CH::Cfg cfg;
+  cfg.hot.swarmOsc.randomPhase = 0;
+  cfg.hot.swarmOsc.morph = 0.f;
+  cfg.hot.swarmOsc.voices = 1;
+  cfg.cold.envs[CH::EnvPitch].depth = 0.f;
+  cfg.cold.envs[CH::EnvClick].depth = 0.f;
+  cfg.cold.envs[CH::EnvMorph].depth = 0.f;
+  return cfg;
+}
+
+static float maxStep(const std::vector<float>& x) {
+  float m = 0.f;
+  for (size_t i = 1; i < x.size(); ++i) m = fmaxf(m, fabsf(x[i] - x[i - 1]));
+  return m;
+}
+
+// Parked: exact zeros out, and the next hit starts from reset envelopes,
+// engine and filters, so it sounds like the first hit of a new instance
+void test_parked_is_silent_and_resumes_from_reset() {
+  const CH::Cfg cfg = shortHit();
+  CH::Feedback fb;
+  const audio::Event hit[] = {hitAt(0)};
+
+  CH fresh(&cfg, &fb);
+  const std::vector<float> ref = render(fresh, 8, hit);
+
+  CH inst(&cfg, &fb);
+  render(inst, 8, hit);
+  int blocks = 0;
+  while (!inst.renderBlock().l.empty()) {
+    TEST_ASSERT_TRUE(++blocks < 100);
+  }
+  TR::BufferT pcm;
+  pcm.fill(1);
+  inst.fillBlock(pcm);
+  for (auto s : pcm) TEST_ASSERT_EQUAL(0, s);
+
+  const std::vector<float> again = render(inst, 8, hit);
+  TEST_ASSERT_TRUE(fabsf(ref[kFrames]) > 0.f);
+  TEST_ASSERT_EQUAL_MEMORY(ref.data(), again.data(),
+                           ref.size() * sizeof(float));
+}
+
+// Exact silence before output frame k, sound from its first internal frame
+// on
+template <class TRx>
+static void checkOnset(int k) {
+  const int at = k * TRx::OS;
+  using Inst = ch::CalcisHumilis<TRx>;
+  typename Inst::Cfg cfg;
+  cfg.hot.swarmOsc.randomPhase = 0;
+  typename Inst::Feedback fb;
+  Inst inst(&cfg, &fb);
+  const audio::Event hit[] = {hitAt(k)};
+  const std::vector<float> out = render(inst, 2, hit);
+  for (int i = 0; i < at; ++i) TEST_ASSERT_EQUAL_FLOAT(0.f, out[i]);
+  TEST_ASSERT_TRUE(out[at] != 0.f);
+  float peak = 0.f;
+  for (size_t i = at; i < out.size(); ++i) peak = fmaxf(peak, fabsf(out[i]));
+  TEST_ASSERT_TRUE(peak > 0.05f);
+}
+
+void test_trigger_starts_on_its_frame() {
+  for (int k : {1, 17, 40}) {
+    checkOnset<TR>(k);
+    checkOnset<audio::AudioTraits<48000, 2, 32, 64>>(k);
+  }
+}
+
+// Past kMaxTriggers a block's extra triggers are ignored
+void test_excess_triggers_are_dropped() {
+  const CH::Cfg cfg = shortHit();
+  CH::Feedback fb;
+  std::array<audio::Event, 12> hits;
+  for (int i = 0; i < 12; ++i) hits[i] = hitAt(5 * i);
+
+  CH first8(&cfg, &fb);
+  const std::vector<float> ref =
+      render(first8, 4, std::span<const audio::Event>(hits).first(8));
+  CH all(&cfg, &fb);
+  const std::vector<float> out = render(all, 4, hits);
+  TEST_ASSERT_EQUAL_MEMORY(ref.data(), out.data(), ref.size() * sizeof(float));
+}
+
+// Each hit takes a free voice while there is one; the one that takes the
+// last starts a fade, which retires its victim after 2 ms
+void test_hits_take_free_voices_then_fade_one() {
+  CH::Cfg cfg = shortHit();
+  cfg.cold.envs[CH::EnvAmp] = {CH::rate(1.f), CH::rate(500.f)};
+  CH::Feedback fb;
+  CH inst(&cfg, &fb);
+  TEST_ASSERT_EQUAL(0, inst.activeVoices());
+  const audio::Event two[] = {hitAt(0), hitAt(20)};
+  render(inst, 1, two);
+  TEST_ASSERT_EQUAL(2, inst.activeVoices());
+  const audio::Event one[] = {hitAt(10)};
+  render(inst, 1, one);
+  TEST_ASSERT_EQUAL(3, inst.activeVoices());
+  render(inst, 1, one);
+  TEST_ASSERT_EQUAL(CH::kVoices, inst.activeVoices());
+  // 96 frames from frame 10: done within the next block
+  render(inst, 1);
+  TEST_ASSERT_EQUAL(CH::kVoices - 1, inst.activeVoices());
+}
+
+// Hits on a rising attack: the oldest voice is the loudest, so the two
+// policies give up different voices. Voices add up independently, so once
+// the fade is over the output matches a run without the victim's hit.
+void test_steal_policy_picks_the_victim() {
+  CH::Cfg cfg = shortHit();
+  cfg.cold.envs[CH::EnvAmp] = {CH::rate(20.f), CH::rate(500.f)};
+  CH::Feedback fb;
+  const int hits = 3 * kFrames;
+  const int quiet = 2 * kFrames;  // newest before the last: lowest level
+
+  for (auto steal : {CH::StealQuietest, CH::StealOldest}) {
+    cfg.cold.voiceSteal = steal;
+    const int victim = steal == CH::StealOldest ? 0 : quiet;
+    CH inst(&cfg, &fb);
+    const std::vector<float> out = renderAt(inst, 8, {0, 64, 128, hits});
+    CH ref(&cfg, &fb);
+    std::vector<float> want;
+    if (victim == 0) {
+      want = renderAt(ref, 8, {64, 128, hits});
+    } else {
+      want = renderAt(ref, 8, {0, 64, hits});
+    }
+    for (int i = 5 * kFrames; i < 8 * kFrames; ++i) {
+      TEST_ASSERT_FLOAT_WITHIN(1e-5f, want[i], out[i]);
+    }
+  }
+}
+
+// More hits than voices in one block: busy voices restart in place, and
+// the block's last hit is heard
+void test_more_hits_than_voices() {
+  const CH::Cfg cfg = shortHit();
+  CH::Feedback fb;
+  CH inst(&cfg, &fb);
+  std::array<audio::Event, 6> hits;
+  for (int i = 0; i < 6; ++i) hits[i] = hitAt(8 * i);
+  const std::vector<float> out = render(inst, 2, hits);
+  TEST_ASSERT_EQUAL(CH::kVoices, inst.activeVoices());
+  for (float x : out) TEST_ASSERT_TRUE(std::isfinite(x));
+  TEST_ASSERT_TRUE(fabsf(out[kFrames - 1]) > 0.f);
+}
+
+// Rolls where each hit gives up a voice and the next takes it back, faded
+// out (400) or 60 frames into its fade (360): no jump beyond the sine's
+// own slope
+void test_retrigger_does_not_click() {
+  const CH::Cfg cfg = sineHit();
+  CH::Feedback fb;
+  CH single(&cfg, &fb);
+  const float slope = maxStep(renderAt(single, 20, {0}));
+
+  CH steal(&cfg, &fb);
+  TEST_ASSERT_TRUE(maxStep(renderAt(steal, 20, {0, 100, 200, 300, 400})) <
+                   1.25f * slope);
+  CH reclaim(&cfg, &fb);
+  TEST_ASSERT_TRUE(maxStep(renderAt(reclaim, 20, {0, 100, 200, 300, 360})) <
+                   1.25f * slope);
+}
+
+}  // namespace calcis_tests
+
+void test_calcis_humilis() {
+  using namespace calcis_tests;
+  RUN_TEST(test_parked_is_silent_and_resumes_from_reset);
+  RUN_TEST(test_trigger_starts_on_its_frame);
+  RUN_TEST(test_excess_triggers_are_dropped);
+  RUN_TEST(test_hits_take_free_voices_then_fade_one);
+  RUN_TEST(test_steal_policy_picks_the_victim);
+  RUN_TEST(test_more_hits_than_voices);
+  RUN_TEST(test_retrigger_does_not_click);
+}
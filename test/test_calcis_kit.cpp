@@ -0,0 +1,187 @@
+#include "platform/test.h"
+// Needs to come first
+
+#include <math.h>
+
+#include <algorithm>
+#include <initializer_list>
+#include <vector>
+
+#include "CalcisKit.h"
+#include "audio/AudioTraits.h"
+
+using namespace zlkm;
+
+namespace kit_tests {
+
+using TR = audio::AudioTraits<48000, 1, 32, 64>;
+static constexpr int kFrames = TR::BLOCK_FRAMES;
+
+template <int N>
+struct Rig {
+  using Kit = ch::CalcisKit<TR, N>;
+  typename Kit::Cfg cfg;
+  typename Kit::Feedback fb;
+
+  // Fixed start phases, so two rigs render the same hit the same way
+  Rig() {
+    for (auto& h : cfg.hot.inst) h.swarmOsc.randomPhase = 0;
+  }
+};
+
+struct Hit {
+  int frame;  // absolute output frame
+  int target;
+};
+
+struct Stereo {
+  std::vector<float> l, r;
+};
+
+// 'blocks' blocks of a fresh kit with 'hits' (ascending); 'perBlock' runs
+// before each block, to edit the cfg
+template <int N, class Edit>
+static Stereo run(Rig<N>& rig, int blocks, std::initializer_list<Hit> hits,
+                  Edit perBlock) {
+  typename Rig<N>::Kit kit(&rig.cfg, &rig.fb);
+  Stereo out;
+  typename TR::BufferT pcm;
+  for (int b = 0; b < blocks; ++b) {
+    perBlock(b);
+    std::vector<audio::Event> events;
+    for (const Hit& h : hits) {
+      if (h.frame / kFrames != b) continue;
+      audio::Event e;
+      e.offset = uint16_t(h.frame - b * kFrames);
+      e.target = uint8_t(h.target);
+      events.push_back(e);
+    }
+    kit.fillBlock(pcm, events);
+    for (int i = 0; i < kFrames; ++i) {
+      out.l.push_back(float(pcm[2 * i]) / 2147483648.f);
+      out.r.push_back(float(pcm[2 * i + 1]) / 2147483648.f);
+    }
+  }
+  return out;
+}
+
+template <int N>
+static Stereo run(Rig<N>& rig, int blocks, std::initializer_list<Hit> hits) {
+  return run(rig, blocks, hits, [](int) {});
+}
+
+static float maxDiff(const Stereo& a, const Stereo& b, int from) {
+  float m = 0.f;
+  for (size_t i = from; i < a.l.size(); ++i) {
+    m = fmaxf(m, fabsf(a.l[i] - b.l[i]));
+    m = fmaxf(m, fabsf(a.r[i] - b.r[i]));
+  }
+  return m;
+}
+
+// Instrument 1 hitting fades instrument 0 out within 2 ms when both share
+// a choke group: from then on only instrument 1 is heard
+void test_choke_group_fades_the_other() {
+  Rig<2> rig;
+  const int closed = 3 * kFrames + 20, done = closed + 96;
+  Rig<2> grouped;
+  grouped.cfg.cold.choke = {1, 1};
+
+  const Stereo alone = run(rig, 12, {{closed, 1}});
+  const Stereo both = run(rig, 12, {{0, 0}, {closed, 1}});
+  const Stereo choked = run(grouped, 12, {{0, 0}, {closed, 1}});
+
+  TEST_ASSERT_TRUE(maxDiff(alone, both, done) > 1e-3f);
+  TEST_ASSERT_TRUE(maxDiff(alone, choked, done) < 1e-6f);
+  // Up to the choke, instrument 0 sounds as without a group
+  for (int i = 0; i <= closed; ++i) {
+    TEST_ASSERT_EQUAL_FLOAT(both.l[i], choked.l[i]);
+  }
+}
+
+// Both hits in one block (open hat at 5, closed at 10): the choke at
+// frame 10 fades the hit at frame 5. The other way round the hit at 10
+// chokes the one at 5 and is not faded by the choke at 5.
+void test_choke_within_one_block() {
+  Rig<2> rig;
+  Rig<2> grouped;
+  grouped.cfg.cold.choke = {1, 1};
+  const int done = kFrames + 10 + 96;
+
+  const Stereo closedAlone = run(rig, 12, {{kFrames + 10, 1}});
+  const Stereo choked = run(grouped, 12, {{kFrames + 5, 0}, {kFrames + 10, 1}});
+  TEST_ASSERT_TRUE(maxDiff(closedAlone, choked, done) < 1e-6f);
+
+  const Stereo lateAlone = run(rig, 12, {{kFrames + 10, 0}});
+  const Stereo late = run(grouped, 12, {{kFrames + 5, 1}, {kFrames + 10, 0}});
+  TEST_ASSERT_TRUE(maxDiff(lateAlone, late, done) < 1e-6f);
+}
+
+// Equal-power pan: hard left is silent on the right and 3 dB over the
+// centre on the left. A gain edit ramps across one block, no step.
+void test_gain_and_pan_ramp() {
+  Rig<1> rig;
+  const Stereo centre = run(rig, 8, {{0, 0}});
+  Rig<1> left;
+  left.cfg.hot.pan[0] = 0.f;
+  const Stereo hard = run(left, 8, {{0, 0}});
+  float peak = 0.f;
+  for (size_t i = 0; i < hard.l.size(); ++i) {
+    TEST_ASSERT_EQUAL_FLOAT(0.f, hard.r[i]);
+    peak = fmaxf(peak, fabsf(hard.l[i]));
+    if (fabsf(centre.l[i]) < 1e-3f) continue;
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, sqrtf(2.f), hard.l[i] / centre.l[i]);
+  }
+  TEST_ASSERT_TRUE(peak > .1f);
+
+  // Gain .8 -> .2 at block 4: the ratio to the steady run falls by 1/64
+  // of the change per frame, then holds
+  Rig<1> edited;
+  const float g0 = edited.cfg.hot.gain[0], g1 = .2f;
+  const Stereo ramp = run(edited, 6, {{0, 0}}, [&](int b) {
+    if (b == 4) edited.cfg.hot.gain[0] = g1;
+  });
+  const Stereo steady = run(rig, 6, {{0, 0}});
+  for (int i = 4 * kFrames; i < 6 * kFrames; ++i) {
+    if (fabsf(steady.l[i]) < 1e-3f) continue;
+    const int f = std::min(i - 4 * kFrames + 1, kFrames);
+    const float want = (g0 + (g1 - g0) * float(f) / float(kFrames)) / g0;
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, want, ramp.l[i] / steady.l[i]);
+  }
+}
+
+// At OS > 1 the kit clips its sum oversampled, as a lone instrument's
+// fillBlock does: with unity gain hard left, a hot instrument comes out
+// the same, clipped samples included
+void test_clips_oversampled() {
+  using TR2 = audio::AudioTraits<48000, 2, 32, 64>;
+  using Kit = ch::CalcisKit<TR2, 1>;
+  Kit::Cfg cfg;
+  cfg.hot.inst[0].swarmOsc.randomPhase = 0;
+  cfg.hot.inst[0].outGain = 8.f;
+  cfg.hot.gain[0] = 1.f;
+  cfg.hot.pan[0] = 0.f;
+  Kit::Feedback kitFb, soloFb;
+  Kit kit(&cfg, &kitFb);
+  Kit::Inst solo(&cfg.hot.inst[0], &cfg.cold.inst[0], &soloFb);
+
+  typename TR2::BufferT a, b;
+  audio::Event hit;
+  for (int blk = 0; blk < 8; ++blk) {
+    const std::span<const audio::Event> ev(&hit, blk ? 0 : 1);
+    kit.fillBlock(a, ev);
+    solo.fillBlock(b, ev);
+    for (int i = 0; i < kFrames; ++i) TEST_ASSERT_EQUAL(b[2 * i], a[2 * i]);
+  }
+  TEST_ASSERT_TRUE(kitFb.saturationCounter > 0);
+}
+
+}  // namespace kit_tests
+
+void test_calcis_kit() {
+  using namespace kit_tests;
+  RUN_TEST(test_choke_group_fades_the_other);
+  RUN_TEST(test_choke_within_one_block);
+  RUN_TEST(test_gain_and_pan_ramp);
+  RUN_TEST(test_clips_oversampled);
+}
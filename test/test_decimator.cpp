@@ -0,0 +1,68 @@
+#include "platform/test.h"
+// Needs to come first
+
+#include <math.h>
+
+#include <array>
+
+#include "dsp/Decimator.h"
+
+using namespace zlkm::dsp;
+
+namespace decimator_tests {
+
+static constexpr int IN = 64;
+
+// Output amplitude (from RMS) after settling for a unit sine at 'cycles'
+// per input sample
+template <int OS>
+static float gainFor(float cycles) {
+  Decimator<OS, IN> d;
+  std::array<float, IN> in;
+  float phase = 0.f, sum = 0.f;
+  int n = 0;
+  for (int b = 0; b < 64; ++b) {
+    for (float& v : in) {
+      v = sinf(6.2831853f * phase);
+      phase += cycles;
+      if (phase >= 1.f) phase -= 1.f;
+    }
+    auto out = d.process(in);
+    TEST_ASSERT_EQUAL(IN / OS, (int)out.size());
+    if (b < 8) continue;
+    for (float v : out) sum += v * v;
+    n += (int)out.size();
+  }
+  return sqrtf(2.f * sum / float(n));
+}
+
+void test_dc_gain_is_unity() {
+  Decimator<4, IN> d;
+  std::array<float, IN> in;
+  in.fill(0.5f);
+  std::span<const float> out;
+  for (int b = 0; b < 8; ++b) out = d.process(in);
+  for (float v : out) TEST_ASSERT_FLOAT_WITHIN(1e-4f, 0.5f, v);
+}
+
+void test_passband_is_flat() {
+  // 10k at 96k and 192k in
+  TEST_ASSERT_FLOAT_WITHIN(1e-3f, 1.f, gainFor<2>(10000.f / 96000.f));
+  TEST_ASSERT_FLOAT_WITHIN(1e-3f, 1.f, gainFor<4>(10000.f / 192000.f));
+}
+
+void test_stopband_is_rejected() {
+  // Would alias to 12k at 48k out; both cascades must be below -70 dB
+  TEST_ASSERT(gainFor<2>(36000.f / 96000.f) < 3.2e-4f);
+  TEST_ASSERT(gainFor<4>(84000.f / 192000.f) < 3.2e-4f);
+  TEST_ASSERT(gainFor<4>(36000.f / 192000.f) < 3.2e-4f);
+}
+
+}  // namespace decimator_tests
+
+void test_decimator() {
+  using namespace decimator_tests;
+  RUN_TEST(test_dc_gain_is_unity);
+  RUN_TEST(test_passband_is_flat);
+  RUN_TEST(test_stopband_is_rejected);
+}
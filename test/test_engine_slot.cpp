@@ -0,0 +1,69 @@
+#include "audio/engine/EngineSlot.h"
+#include "platform/test.h"
+
+using zlkm::audio::engine::EngineSlot;
+using zlkm::audio::engine::Tag;
+
+namespace engine_slot_tests {
+
+static int alive = 0;
+
+struct Sine {
+  explicit Sine(float f) : freq(f) { ++alive; }
+  ~Sine() { --alive; }
+  float render() const { return freq; }
+  float freq;
+};
+
+struct Noise {
+  explicit Noise(int s) : seed(s) { ++alive; }
+  ~Noise() { --alive; }
+  float render() const { return -float(seed); }
+  int seed;
+};
+
+struct Args {
+  float freq = 440.f;
+  int seed = 7;
+  float operator()(Tag<Sine>) const { return freq; }
+  int operator()(Tag<Noise>) const { return seed; }
+};
+
+void test_select_switches_in_place() {
+  {
+    EngineSlot<Sine, Noise> slot;
+    Args args;
+    float out = 0.f;
+    auto render = [&] { slot.visit([&](auto& e) { out = e.render(); }); };
+
+    TEST_ASSERT_TRUE(slot.empty());
+    render();  // empty slot: nothing runs
+    TEST_ASSERT_EQUAL_FLOAT(0.f, out);
+
+    TEST_ASSERT_TRUE(slot.select(0, args));
+    render();
+    TEST_ASSERT_EQUAL_FLOAT(440.f, out);
+
+    args.freq = 220.f;
+    TEST_ASSERT_FALSE(slot.select(0, args));  // already active: kept
+    render();
+    TEST_ASSERT_EQUAL_FLOAT(440.f, out);
+
+    TEST_ASSERT_TRUE(slot.select(1, args));
+    TEST_ASSERT_EQUAL(1u, slot.index());
+    TEST_ASSERT_EQUAL(1, alive);  // old engine destroyed
+    render();
+    TEST_ASSERT_EQUAL_FLOAT(-7.f, out);
+
+    TEST_ASSERT_FALSE(slot.select(2, args));  // out of range
+    TEST_ASSERT_EQUAL(1u, slot.index());
+  }
+  TEST_ASSERT_EQUAL(0, alive);
+}
+
+}  // namespace engine_slot_tests
+
+void test_engine_slot() {
+  using namespace engine_slot_tests;
+  RUN_TEST(test_select_switches_in_place);
+}
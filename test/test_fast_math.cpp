@@ -0,0 +1,82 @@
+#include "platform/test.h"
+// Needs to come first
+
+#include <math.h>
+
+#include "math/Fast.h"
+
+using namespace zlkm::math;
+using fast::Tier;
+
+namespace fast_math_tests {
+
+// Max error of 'approx' vs 'ref' over n log- or lin-spaced points in [a, b]
+template <class A, class R>
+static float maxErr(A approx, R ref, float a, float b, bool relative,
+                    bool logSpaced = false, int n = 20000) {
+  float worst = 0.f;
+  for (int i = 0; i <= n; ++i) {
+    const float u = float(i) / float(n);
+    const float x = logSpaced ? a * powf(b / a, u) : a + (b - a) * u;
+    const double r = ref(double(x));
+    double e = fabs(double(approx(x)) - r);
+    if (relative) e /= fabs(r);
+    worst = fmaxf(worst, float(e));
+  }
+  return worst;
+}
+
+template <Tier T>
+static void checkTier(float eSin, float eTan, float eExp, float eLog,
+                      float eTanh, float eSqrt) {
+  const double twoPi = 6.283185307179586;
+  TEST_ASSERT(maxErr([](float t) { return fast::sin01<T>(t); },
+                     [&](double t) { return ::sin(twoPi * t); }, -2.f, 2.f,
+                     false) < eSin);
+  TEST_ASSERT(maxErr([](float x) { return fast::tanPi<T>(x); },
+                     [&](double x) { return ::tan(0.5 * twoPi * x); }, 1e-4f,
+                     0.45f, true) < eTan);
+  TEST_ASSERT(maxErr([](float x) { return fast::exp2<T>(x); },
+                     [](double x) { return ::exp2(x); }, -20.f, 20.f,
+                     true) < eExp);
+  TEST_ASSERT(maxErr([](float x) { return fast::log2<T>(x); },
+                     [](double x) { return ::log2(x); }, 1e-3f, 1e4f, false,
+                     true) < eLog);
+  TEST_ASSERT(maxErr([](float x) { return fast::tanh<T>(x); },
+                     [](double x) { return ::tanh(x); }, -10.f, 10.f,
+                     false) < eTanh);
+  TEST_ASSERT(maxErr([](float x) { return fast::sqrt<T>(x); },
+                     [](double x) { return ::sqrt(x); }, 1e-4f, 1e4f, true,
+                     true) < eSqrt);
+}
+
+// Bounds mirror the table in math/Fast.h (with a little headroom)
+void test_low_tier_error() {
+  checkTier<Tier::Low>(8e-5f, 5e-4f, 9e-5f, 1e-3f, 5e-5f, 2e-3f);
+}
+
+void test_mid_tier_error() {
+  checkTier<Tier::Mid>(1e-6f, 5e-6f, 4e-6f, 7e-6f, 3e-6f, 6e-6f);
+}
+
+void test_high_tier_error() {
+  checkTier<Tier::High>(3e-7f, 1e-6f, 3e-7f, 1.5e-6f, 4e-7f, 1e-7f);
+}
+
+void test_exp2_log2_exact_at_powers_of_two() {
+  for (int k = -10; k <= 10; ++k) {
+    TEST_ASSERT_EQUAL_FLOAT(ldexpf(1.f, k), fast::exp2<Tier::High>(k));
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, float(k),
+                             fast::log2<Tier::High>(ldexpf(1.f, k)));
+  }
+}
+
+}  // namespace fast_math_tests
+
+void test_fast_math() {
+  using namespace fast_math_tests;
+  RUN_TEST(test_low_tier_error);
+  RUN_TEST(test_mid_tier_error);
+  RUN_TEST(test_high_tier_error);
+  RUN_TEST(test_exp2_log2_exact_at_powers_of_two);
+}
@@ -51,6 +51,57 @@ void test_drive_monotonic() {
   TEST_ASSERT(d1 > d0);
 }
 
+// Resonant, half-driven input so both the SVF and its clipper are busy
+static float probe(int i) {
+  return 0.8f * sinf(0.07f * float(i)) + 0.3f * sinf(1.3f * float(i));
+}
+
+void test_process_block_matches_process() {
+  Filter::Cfg cfg{};
+  Safe p(&cfg, 0.3f, 0.8f, 0.4f, 0.6f);
+  Filter a, b;
+  std::array<float, 32> in{}, out{};
+  for (int blk = 0, i = 0; blk < 8; ++blk) {
+    for (float& x : in) x = probe(i++);
+    b.processBlock(in, out, cfg);
+    for (size_t k = 0; k < in.size(); ++k) {
+      TEST_ASSERT_FLOAT_WITHIN(1e-6f, a.process(in[k], cfg), out[k]);
+    }
+  }
+}
+
+void test_ramped_block_matches_process() {
+  Filter::Cfg from{}, to{};
+  Safe pf(&from, 0.2f, 0.1f, 0.0f, 0.2f);
+  Safe pt(&to, 0.7f, 0.9f, 1.0f, 0.8f);
+  Filter a, b;
+  std::array<float, 32> buf{};
+  for (size_t k = 0; k < buf.size(); ++k) buf[k] = probe(int(k));
+  const std::array<float, 32> in = buf;
+  b.processBlock(buf, buf, from, to);  // in place
+
+  // Per sample: one step of the ramp before each sample
+  const float inv = 1.f / float(in.size());
+  Filter::Cfg c = from;
+  float* pc = &c.gCut;
+  const auto& t = to.asTarget();
+  std::array<float, Filter::Cfg::PCOUNT> d;
+  for (int k = 0; k < Filter::Cfg::PCOUNT; ++k) d[k] = (t[k] - pc[k]) * inv;
+  for (size_t i = 0; i < in.size(); ++i) {
+    for (int k = 0; k < Filter::Cfg::PCOUNT; ++k) pc[k] += d[k];
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, a.process(in[i], c), buf[i]);
+  }
+  TEST_ASSERT_FLOAT_WITHIN(1e-5f, to.gCut, c.gCut);
+  // State carries over: both continue alike on the target cfg
+  for (int i = 0; i < 16; ++i) {
+    const float x = probe(100 + i);
+    float y;
+    b.processBlock(std::span<const float>(&x, 1), std::span<float>(&y, 1),
+                   to);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, a.process(x, to), y);
+  }
+}
+
 }  // namespace filter_tests
 
 void test_filter_params() {
@@ -59,4 +110,6 @@ void test_filter_params() {
   RUN_TEST(test_cutoff_monotonic);
   RUN_TEST(test_resonance_effect);
   RUN_TEST(test_drive_monotonic);
+  RUN_TEST(test_process_block_matches_process);
+  RUN_TEST(test_ramped_block_matches_process);
 }
@@ -0,0 +1,85 @@
+#include "platform/test.h"
+// Needs to come first
+
+#include <math.h>
+
+#include <array>
+
+#include "audio/engine/FM.h"
+#include "math/Fast.h"
+
+using namespace zlkm::audio::engine;
+
+namespace fm_tests {
+
+static constexpr int FRAMES = 64;
+using Fm = FM<4>;
+
+// Envelopes that jump to 1 and hold for the whole test
+static std::array<Fm::EnvCfg, 4> holdEnvs() {
+  std::array<Fm::EnvCfg, 4> e;
+  e.fill(Fm::EnvCfg{1.f, 1e-9f, 1.f, zlkm::mod::EnvCurve{1.f}});
+  return e;
+}
+
+struct Block {
+  std::array<float, FRAMES> cps, l, r;
+  Block() { cps.fill(0.01f); }
+  void run(Fm& fm, const Fm::Cfg& target, bool changed = true) {
+    fm.processBlock(cps, l, r, target, changed);
+  }
+};
+
+void test_idle_until_triggered() {
+  Fm::Cfg c;
+  Fm fm(c);
+  fm.setEnvs(holdEnvs());
+  Block b;
+  b.run(fm, c);
+  for (float v : b.l) TEST_ASSERT_EQUAL_FLOAT(0.f, v);
+}
+
+void test_unmodulated_carrier_is_a_sine() {
+  Fm::Cfg c;
+  c.level = {1.f, 0.f, 0.f, 0.f};
+  c.feedback = 0.f;
+  Fm fm(c);
+  fm.setEnvs(holdEnvs());
+  fm.reset();
+  Block b;
+  b.run(fm, c);
+  for (int f = 0; f < FRAMES; ++f) {
+    const float want = zlkm::math::fast::sin01(0.01f * float(f));
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, want, b.l[f]);
+    TEST_ASSERT_EQUAL_FLOAT(b.l[f], b.r[f]);
+  }
+}
+
+void test_every_algorithm_stays_bounded() {
+  for (int a = 0; a < Fm::kAlgorithms; ++a) {
+    Fm::Cfg c;
+    c.algorithm = a;
+    c.level = {1.f, 1.f, 1.f, 1.f};
+    c.feedback = 1.f;
+    Fm fm(c);
+    fm.setEnvs(holdEnvs());
+    fm.reset();
+    Block b;
+    float peak = 0.f;
+    for (int blk = 0; blk < 50; ++blk) {
+      b.run(fm, c, blk == 0);
+      for (float v : b.l) peak = fmaxf(peak, fabsf(v));
+    }
+    // Carriers are normalized by their count
+    TEST_ASSERT_TRUE(peak > 0.1f && peak <= 1.001f);
+  }
+}
+
+}  // namespace fm_tests
+
+void test_fm() {
+  using namespace fm_tests;
+  RUN_TEST(test_idle_until_triggered);
+  RUN_TEST(test_unmodulated_carrier_is_a_sine);
+  RUN_TEST(test_every_algorithm_stays_bounded);
+}
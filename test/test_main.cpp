@@ -8,6 +8,22 @@ void test_interpolators();
 void test_quad_manager();
 void test_button_manager();
 void test_idle_timer();
+void test_morph_osc();
+void test_swarm();
+void test_decimator();
+void test_pcm();
+void test_fast_math();
+void test_triple_buffer();
+void test_param_queue();
+void test_audio_sink();
+void test_scheduler();
+void test_mod_matrix();
+void test_param_spec();
+void test_engine_slot();
+void test_fm();
+void test_soft_clip();
+void test_calcis_humilis();
+void test_calcis_kit();
 
 void setUp(void) {}
 void tearDown(void) {}
@@ -23,5 +39,21 @@ TEST_MAIN() {
   test_quad_manager();
   test_button_manager();
   test_idle_timer();
+  test_morph_osc();
+  test_swarm();
+  test_decimator();
+  test_pcm();
+  test_fast_math();
+  test_triple_buffer();
+  test_param_queue();
+  test_audio_sink();
+  test_scheduler();
+  test_mod_matrix();
+  test_param_spec();
+  test_engine_slot();
+  test_fm();
+  test_soft_clip();
+  test_calcis_humilis();
+  test_calcis_kit();
   UNITY_END();
 }
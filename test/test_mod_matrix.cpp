@@ -0,0 +1,61 @@
+#include "mod/ModMatrix.h"
+#include "platform/test.h"
+
+using zlkm::mod::ModMatrix;
+using zlkm::mod::Route;
+
+namespace mod_matrix_tests {
+
+using Matrix = ModMatrix<2, 3, 4>;
+using Sources = std::array<std::array<float, 4>, 2>;
+
+static const Sources kSrc = {{{0.f, .25f, .5f, 1.f}, {1.f, 1.f, 0.f, 0.f}}};
+
+void test_empty_table_routes_nothing() {
+  Matrix m;
+  std::array<Route, 4> routes{};
+  routes[0] = Route{0, 1, 0, 0, 5.f};  // disabled
+  routes[1] = Route{1, 2, 0, 1, 0.f};  // zero depth
+  m.compile(routes);
+  TEST_ASSERT_TRUE(m.empty());
+  for (int d = 0; d < 3; ++d) TEST_ASSERT_FALSE(m.routed(d));
+}
+
+void test_routes_sum_per_destination() {
+  Matrix m;
+  std::array<Route, 4> routes{};
+  routes[0] = Route{0, 2, 0, 1, 2.f};
+  routes[1] = Route{1, 0, 0, 1, -1.f};
+  routes[2] = Route{1, 2, 0, 1, .5f};
+  m.compile(routes);
+  TEST_ASSERT_FALSE(m.routed(1));
+
+  std::array<float, 4> out = {1.f, 1.f, 1.f, 1.f};
+  m.add(2, kSrc, 0, out);
+  const float expect[4] = {1.5f, 2.f, 2.f, 3.f};
+  for (int i = 0; i < 4; ++i) TEST_ASSERT_EQUAL_FLOAT(expect[i], out[i]);
+
+  std::array<float, 2> tail = {};
+  m.add(2, kSrc, 2, tail);  // source frames 2 and 3
+  TEST_ASSERT_EQUAL_FLOAT(1.f, tail[0]);
+  TEST_ASSERT_EQUAL_FLOAT(-1.f, m.at(0, kSrc, 0));
+}
+
+void test_bipolar_maps_half_to_zero() {
+  Matrix m;
+  std::array<Route, 4> routes{};
+  routes[0] = Route{0, 1, 1, 1, 3.f};
+  m.compile(routes);
+  TEST_ASSERT_EQUAL_FLOAT(-3.f, m.at(1, kSrc, 0));
+  TEST_ASSERT_EQUAL_FLOAT(0.f, m.at(1, kSrc, 2));
+  TEST_ASSERT_EQUAL_FLOAT(3.f, m.at(1, kSrc, 3));
+}
+
+}  // namespace mod_matrix_tests
+
+void test_mod_matrix() {
+  using namespace mod_matrix_tests;
+  RUN_TEST(test_empty_table_routes_nothing);
+  RUN_TEST(test_routes_sum_per_destination);
+  RUN_TEST(test_bipolar_maps_half_to_zero);
+}
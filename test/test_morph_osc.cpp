@@ -0,0 +1,113 @@
+#include "platform/test.h"
+// Needs to come first
+
+#include <math.h>
+
+#include "audio/MorphOsc.h"
+
+using namespace zlkm::audio;
+
+namespace morph_osc_tests {
+
+static constexpr int N = 4;
+using Osc = MorphOscN<N, 48000>;
+
+static void setup(Osc& o, float morph) {
+  for (int i = 0; i < N; ++i) {
+    o.state.dt[i] = 0.003f + 0.011f * float(i);
+    o.state.morph[i] = morph;
+    o.state.pulseWidth[i] = 0.4f;
+  }
+}
+
+void test_block_matches_per_sample_ticks() {
+  constexpr int FRAMES = 64;
+  for (float morph : {0.f, 0.3f, 0.55f, 0.8f, 1.f}) {
+    Osc a, b;
+    setup(a, morph);
+    setup(b, morph);
+    std::array<float, FRAMES * N> block{};
+    a.renderBlock(block.data(), FRAMES, [](int, Osc::State&) {});
+    for (int f = 0; f < FRAMES; ++f) {
+      std::array<float, N> one{};
+      b.tick(one);
+      for (int i = 0; i < N; ++i) {
+        TEST_ASSERT_FLOAT_WITHIN(1e-6f, one[i], block[f * N + i]);
+      }
+    }
+  }
+}
+
+void test_morph_zero_is_sine() {
+  Osc o;
+  setup(o, 0.f);
+  float t = 0.f;
+  for (int f = 0; f < 200; ++f) {
+    std::array<float, N> out{};
+    o.tick(out);
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, sinf(6.2831853f * t), out[0]);
+    t += o.state.dt[0];
+    if (t >= 1.f) t -= 1.f;
+  }
+}
+
+void test_per_frame_callback_drives_pitch() {
+  Osc o;
+  setup(o, 1.f);
+  std::array<float, 8 * N> block{};
+  o.renderBlock(block.data(), 8, [](int f, Osc::State& s) {
+    s.dt[0] = 0.01f * float(f + 1);
+  });
+  // 0.01 + 0.02 + ... + 0.08 = 0.36 cycles advanced
+  TEST_ASSERT_FLOAT_WITHIN(1e-5f, 0.36f, o.state.phase[0]);
+}
+
+void test_bandlimited_edges_stay_bounded() {
+  Osc o;
+  for (float morph : {0.5f, 0.75f, 1.f}) {
+    setup(o, morph);
+    for (int f = 0; f < 2000; ++f) {
+      std::array<float, N> out{};
+      o.tick(out);
+      for (float v : out) TEST_ASSERT(fabsf(v) < 2.f);
+    }
+  }
+}
+
+void test_table_levels_stay_below_nyquist() {
+  using Tables = Osc::Tables;
+  for (float dt = 1e-4f; dt < 0.5f; dt *= 1.07f) {
+    const int lvl = Tables::level(dt);
+    TEST_ASSERT(float(Tables::harmonics(lvl)) * dt <= 0.5f);
+    // One level finer would alias (unless already the finest)
+    if (lvl > 0) TEST_ASSERT(float(Tables::harmonics(lvl - 1)) * dt > 0.5f);
+  }
+}
+
+void test_table_mode_tracks_blep_mode() {
+  // At low pitch both paths approximate the same naive shapes
+  for (float morph : {0.f, 0.33333f, 0.66667f, 1.f}) {
+    Osc a, b;
+    setup(a, morph);
+    setup(b, morph);
+    b.mode = Osc::ModeTable;
+    std::array<float, 256 * N> ba{}, bb{};
+    a.renderBlock(ba.data(), 256, [](int, Osc::State&) {});
+    b.renderBlock(bb.data(), 256, [](int, Osc::State&) {});
+    float err = 0.f;
+    for (int k = 0; k < 256; ++k) err += fabsf(ba[k * N] - bb[k * N]);
+    TEST_ASSERT(err / 256.f < 0.02f);
+  }
+}
+
+}  // namespace morph_osc_tests
+
+void test_morph_osc() {
+  using namespace morph_osc_tests;
+  RUN_TEST(test_block_matches_per_sample_ticks);
+  RUN_TEST(test_morph_zero_is_sine);
+  RUN_TEST(test_per_frame_callback_drives_pitch);
+  RUN_TEST(test_bandlimited_edges_stay_bounded);
+  RUN_TEST(test_table_levels_stay_below_nyquist);
+  RUN_TEST(test_table_mode_tracks_blep_mode);
+}
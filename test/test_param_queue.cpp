@@ -0,0 +1,140 @@
+#include "platform/test.h"
+#include "util/ParamQueue.h"
+#include "util/SpscQueue.h"
+
+using zlkm::util::ParamQueue;
+using zlkm::util::SpscQueue;
+
+namespace param_queue_tests {
+
+struct Cfg {
+  float gain = 0.5f;
+  int voices = 1;
+  bool flag = false;
+  float coeffs[3] = {0.f, 0.f, 0.f};
+};
+
+using Queue = ParamQueue<Cfg, 8>;
+
+// Reader and writer in sync after the initial snapshot
+static void startSynced(Queue& q, const Cfg& ui, Cfg& audio) {
+  q.flush(ui);
+  q.apply(audio);
+}
+
+void test_spsc_push_is_all_or_nothing() {
+  SpscQueue<int, 4> q;
+  const int three[3] = {1, 2, 3};
+  TEST_ASSERT_TRUE(q.push(three));
+  TEST_ASSERT_FALSE(q.push(three));  // only one slot left
+  TEST_ASSERT_EQUAL(1u, q.writeAvailable());
+  for (int v : three) {
+    TEST_ASSERT_NOT_NULL(q.peek());
+    TEST_ASSERT_EQUAL(v, *q.peek());
+    q.pop();
+  }
+  TEST_ASSERT_NULL(q.peek());
+  TEST_ASSERT_TRUE(q.push(three));  // wraps around
+}
+
+void test_changed_fields_reach_reader() {
+  Queue q;
+  Cfg ui, audio;
+  ui.voices = 3;
+  startSynced(q, ui, audio);
+  TEST_ASSERT_EQUAL(3, audio.voices);
+
+  ui.gain = 0.25f;
+  q.changed(ui, &ui.gain, sizeof(ui.gain));
+  ui.flag = true;
+  q.changed(ui, &ui.flag, sizeof(ui.flag));
+  ui.coeffs[1] = 2.f;
+  ui.coeffs[2] = 3.f;
+  q.changed(ui, &ui.coeffs, sizeof(ui.coeffs));
+  ui.voices = 7;  // not reported: must not leak through
+
+  q.flush(ui);  // no overflow: no snapshot
+  q.apply(audio);
+  TEST_ASSERT_EQUAL_FLOAT(0.25f, audio.gain);
+  TEST_ASSERT_TRUE(audio.flag);
+  TEST_ASSERT_EQUAL_FLOAT(2.f, audio.coeffs[1]);
+  TEST_ASSERT_EQUAL_FLOAT(3.f, audio.coeffs[2]);
+  TEST_ASSERT_EQUAL(3, audio.voices);
+  TEST_ASSERT_EQUAL(0u, q.overflows());
+}
+
+void test_overflow_falls_back_to_snapshot_in_order() {
+  Queue q;
+  Cfg ui, audio;
+  startSynced(q, ui, audio);
+
+  // Seven single-word edits, then a 3-word field that no longer fits the
+  // 8-deep queue; the reader is not draining
+  for (int i = 1; i <= 7; ++i) {
+    ui.voices = i;
+    q.changed(ui, &ui.voices, sizeof(ui.voices));
+  }
+  ui.voices = 9;
+  ui.coeffs[0] = 1.f;
+  q.changed(ui, &ui.coeffs, sizeof(ui.coeffs));
+  TEST_ASSERT_EQUAL(1u, q.overflows());
+  q.flush(ui);  // snapshot has voices = 9
+
+  // Newer edit after the snapshot must win over it, and the stale events
+  // still queued ahead of it must not override the snapshot
+  ui.gain = 0.125f;
+  q.changed(ui, &ui.gain, sizeof(ui.gain));
+
+  q.apply(audio);
+  TEST_ASSERT_EQUAL(9, audio.voices);
+  TEST_ASSERT_EQUAL_FLOAT(1.f, audio.coeffs[0]);
+  TEST_ASSERT_EQUAL_FLOAT(0.125f, audio.gain);
+
+  // Back on the event path afterwards
+  ui.voices = 2;
+  q.changed(ui, &ui.voices, sizeof(ui.voices));
+  q.apply(audio);
+  TEST_ASSERT_EQUAL(2, audio.voices);
+}
+
+struct SplitCfg {
+  struct Hot {
+    float gain = 0.5f;
+  } hot;
+  struct Cold {
+    float table[32] = {};
+  } cold;
+};
+
+void test_split_sections_snapshot_independently() {
+  zlkm::util::SplitParamQueue<SplitCfg, 8, 8> q;
+  SplitCfg ui, audio;
+  q.flush(ui);
+  q.apply(audio);
+
+  // A cold edit too large for events snapshots the cold section only
+  ui.cold.table[31] = 3.f;
+  q.changed(ui, &ui.cold.table, sizeof(ui.cold.table));
+  ui.hot.gain = 0.8f;
+  q.changed(ui, &ui.hot.gain, sizeof(ui.hot.gain));
+  q.flush(ui);
+  q.apply(audio);
+  TEST_ASSERT_EQUAL_FLOAT(3.f, audio.cold.table[31]);
+  TEST_ASSERT_EQUAL_FLOAT(0.8f, audio.hot.gain);  // via its event
+
+  // No hot snapshot was taken: a local change on the reader survives
+  audio.hot.gain = -1.f;
+  q.flush(ui);
+  q.apply(audio);
+  TEST_ASSERT_EQUAL_FLOAT(-1.f, audio.hot.gain);
+}
+
+}  // namespace param_queue_tests
+
+void test_param_queue() {
+  using namespace param_queue_tests;
+  RUN_TEST(test_spsc_push_is_all_or_nothing);
+  RUN_TEST(test_changed_fields_reach_reader);
+  RUN_TEST(test_overflow_falls_back_to_snapshot_in_order);
+  RUN_TEST(test_split_sections_snapshot_independently);
+}
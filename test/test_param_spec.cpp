@@ -0,0 +1,96 @@
+#include "platform/test.h"
+// Needs to come first
+
+#include "app/params/Spec.h"
+#include "ui/InputMapper.h"
+
+using namespace zlkm::app::params;
+using zlkm::ui::InputMapper;
+using zlkm::ui::SpecMapper;
+
+namespace param_spec_tests {
+
+struct Engine {
+  static constexpr int MAX_SWARM_VOICES = 8;
+  static constexpr int OscCount = 2;
+};
+using Reg = Registry<Engine>;
+
+void test_curves_round_trip() {
+  for (int id = 0; id < IdCount; ++id) {
+    const Spec& s = Reg::get(Id(id));
+    if (s.curve == Curve::Step) continue;
+    for (float x : {0.f, .1f, .5f, .9f, 1.f}) {
+      TEST_ASSERT_FLOAT_WITHIN(1e-4f, x, s.fromDomain(s.toDomain(x)));
+    }
+  }
+  // Octave: the middle of the knob is the geometric mean
+  const Spec& q = Reg::get(FilterRes);
+  TEST_ASSERT_FLOAT_WITHIN(1e-3f, q.min, q.toDomain(0.f));
+  TEST_ASSERT_FLOAT_WITHIN(1e-3f, q.max, q.toDomain(1.f));
+  const Spec oct{"o", "Hz", 20.f, 20480.f, Curve::Octave};
+  TEST_ASSERT_FLOAT_WITHIN(1e-2f, 640.f, oct.toDomain(.5f));
+}
+
+void test_table_tracks_curve() {
+  const Spec& q = Reg::get(FilterRes);
+  const Table<> t(q);
+  for (int i = 0; i <= 100; ++i) {
+    const float x = float(i) / 100.f;
+    const float v = q.toDomain(x);
+    TEST_ASSERT_FLOAT_WITHIN(v * 5e-3f, v, t(x));
+  }
+}
+
+void test_mapper_stores_through_spec() {
+  float rate = 0.f;
+  auto im = SpecMapper<Reg, AmpDecay, float, Rate<48000>>::make(&rate);
+  im.mapAndSet(InputMapper::kMaxRawValue);
+  TEST_ASSERT_FLOAT_WITHIN(1e-9f, zlkm::dsp::msToRate(2000.f, 48000.f), rate);
+  for (int raw : {800, 2048, 3000}) {
+    im.mapAndSet(raw);
+    TEST_ASSERT_INT_WITHIN(8, raw, im.reverseMap());
+  }
+
+  int voices = 0;
+  auto iv = SpecMapper<Reg, Voices, int>::make(&voices);
+  iv.mapAndSet(InputMapper::kMaxRawValue);
+  TEST_ASSERT_EQUAL(Engine::MAX_SWARM_VOICES, voices);
+  iv.mapAndSet(0);
+  TEST_ASSERT_EQUAL(1, voices);
+
+  bool on = false;
+  auto ib = SpecMapper<Reg, RandomPhase, bool>::make(&on);
+  ib.mapAndSet(InputMapper::kMaxRawValue);
+  TEST_ASSERT_TRUE(on);
+  TEST_ASSERT_EQUAL(InputMapper::kMaxRawValue, ib.reverseMap());
+}
+
+void test_kit_entries_sized_by_registry() {
+  using Kit = Registry<Engine, zlkm::audio::DJFilterLimitsDefault, 3, 4>;
+  int inst = 0;
+  auto ii = SpecMapper<Kit, Instrument, int>::make(&inst);
+  ii.mapAndSet(InputMapper::kMaxRawValue);
+  TEST_ASSERT_EQUAL(2, inst);
+  uint8_t group = 0;
+  auto ig = SpecMapper<Kit, Choke, uint8_t>::make(&group);
+  ig.mapAndSet(InputMapper::kMaxRawValue);
+  TEST_ASSERT_EQUAL(3, group);
+
+  // A lone instrument: an empty range reads back as 0, not NaN
+  inst = 0;
+  auto i1 = SpecMapper<Reg, Instrument, int>::make(&inst);
+  TEST_ASSERT_EQUAL(0, i1.reverseMap());
+  i1.mapAndSet(InputMapper::kMaxRawValue);
+  TEST_ASSERT_EQUAL(0, inst);
+}
+
+}  // namespace param_spec_tests
+
+void test_param_spec() {
+  using namespace param_spec_tests;
+  RUN_TEST(test_curves_round_trip);
+  RUN_TEST(test_table_tracks_curve);
+  RUN_TEST(test_mapper_stores_through_spec);
+  RUN_TEST(test_kit_entries_sized_by_registry);
+}
@@ -0,0 +1,60 @@
+#include "platform/test.h"
+// Needs to come first
+
+#include "audio/AudioTraits.h"
+#include "audio/Pcm.h"
+
+using namespace zlkm::audio;
+
+namespace pcm_tests {
+
+using TR16 = AudioTraits<48000, 1, 16, 4>;
+using TR24 = AudioTraits<48000, 1, 24, 4>;
+using TR24P = AudioTraits<48000, 1, 24, 4, true, true>;
+using TR32 = AudioTraits<48000, 1, 32, 4>;
+
+void test_ssat_clamps_to_width() {
+  TEST_ASSERT_EQUAL_INT32(32767, ssat<16>(40000));
+  TEST_ASSERT_EQUAL_INT32(-32768, ssat<16>(-40000));
+  TEST_ASSERT_EQUAL_INT32(1234, ssat<16>(1234));
+  TEST_ASSERT_EQUAL_INT32(8388607, ssat<24>(1 << 24));
+}
+
+void test_formats_scale_and_saturate() {
+  TR16::BufferT b16{};
+  Pcm<TR16>::putFrame(b16, 0, 0.5f, -2.f);
+  TEST_ASSERT_EQUAL_INT16(16384, b16[0]);
+  TEST_ASSERT_EQUAL_INT16(-32768, b16[1]);
+
+  TR24::BufferT b24{};
+  Pcm<TR24>::putFrame(b24, 0, 1.5f, -0.25f);
+  TEST_ASSERT_EQUAL_INT32(int32_t(8388607u << 8), b24[0]);
+  TEST_ASSERT_EQUAL_INT32(-2097152 * 256, b24[1]);
+
+  TR32::BufferT b32{};
+  Pcm<TR32>::putFrame(b32, 1, -1.f, 0.f);
+  TEST_ASSERT_EQUAL_INT32(INT32_MIN, b32[2]);
+  TEST_ASSERT_EQUAL_INT32(0, b32[3]);
+}
+
+void test_packed_24_is_three_le_bytes() {
+  static_assert(TR24P::BLOCK_BYTES == 4 * 2 * 3, "3 bytes per sample");
+  TR24P::BufferT b{};
+  Pcm<TR24P>::putFrame(b, 1, -1.f, 0.5f);
+  // -1.0 -> 0x800000, 0.5 -> 0x400000
+  TEST_ASSERT_EQUAL_UINT8(0x00, b[6]);
+  TEST_ASSERT_EQUAL_UINT8(0x00, b[7]);
+  TEST_ASSERT_EQUAL_UINT8(0x80, b[8]);
+  TEST_ASSERT_EQUAL_UINT8(0x00, b[9]);
+  TEST_ASSERT_EQUAL_UINT8(0x00, b[10]);
+  TEST_ASSERT_EQUAL_UINT8(0x40, b[11]);
+}
+
+}  // namespace pcm_tests
+
+void test_pcm() {
+  using namespace pcm_tests;
+  RUN_TEST(test_ssat_clamps_to_width);
+  RUN_TEST(test_formats_scale_and_saturate);
+  RUN_TEST(test_packed_24_is_three_le_bytes);
+}
@@ -0,0 +1,75 @@
+#include "platform/test.h"
+#include "util/Scheduler.h"
+
+namespace scheduler_tests {
+
+struct FakeClock {
+  static inline uint32_t t = 0;
+  static uint32_t now() { return t; }
+};
+
+using Sched = zlkm::util::Scheduler<2, FakeClock>;
+
+// Each task logs its id and runs for 'cost' us of fake time
+struct Job {
+  int id;
+  uint32_t cost;
+  int* log;
+  int* n;
+};
+static void run(void* ctx) {
+  auto* j = static_cast<Job*>(ctx);
+  j->log[(*j->n)++] = j->id;
+  FakeClock::t += j->cost;
+}
+
+void test_earliest_deadline_runs_first() {
+  FakeClock::t = 0;
+  int log[16], n = 0;
+  Job fast{0, 10, log, &n}, slow{1, 10, log, &n};
+  Sched s({{{"fast", &run, &fast, 1000, 0, 0},
+            {"slow", &run, &slow, 10000, 0, 0}}});
+
+  // Both released at 0: the 1 ms deadline goes first, one task per call
+  TEST_ASSERT_EQUAL_UINT32(0, s.runOnce());
+  TEST_ASSERT_EQUAL_UINT32(980, s.runOnce());  // next: fast at 1000
+  TEST_ASSERT_EQUAL(2, n);
+  TEST_ASSERT_EQUAL(0, log[0]);
+  TEST_ASSERT_EQUAL(1, log[1]);
+
+  FakeClock::t = 1000;
+  s.runOnce();
+  TEST_ASSERT_EQUAL(0, log[2]);
+  TEST_ASSERT_EQUAL_UINT32(2, s.stats(0).runs);
+  TEST_ASSERT_EQUAL_UINT32(0, s.stats(0).late);
+}
+
+void test_overruns_are_counted_and_releases_skipped() {
+  FakeClock::t = 0;
+  int log[16], n = 0;
+  Job hog{0, 3500, log, &n}, tick{1, 10, log, &n};
+  Sched s({{{"hog", &run, &hog, 10000, 0, 2000},
+            {"tick", &run, &tick, 1000, 0, 0}}});
+
+  s.runOnce();  // tick (tighter deadline)
+  s.runOnce();  // hog: 3.5 ms against a 2 ms budget
+  TEST_ASSERT_EQUAL_UINT32(1, s.stats(0).overBudget);
+  TEST_ASSERT_EQUAL_UINT32(0, s.stats(0).late);
+
+  // tick was due at 1000 and finishes at 3520: late. The release at 2000
+  // is dropped; the one at 3000 runs once, then it is back in phase
+  s.runOnce();
+  TEST_ASSERT_EQUAL_UINT32(1, s.stats(1).late);
+  TEST_ASSERT_EQUAL_UINT32(1, s.stats(1).skipped);
+  TEST_ASSERT_EQUAL_UINT32(2510, s.stats(1).maxLatencyUs);
+  TEST_ASSERT_EQUAL_UINT32(470, s.runOnce());  // nothing due until 4000
+  TEST_ASSERT_EQUAL_UINT32(3, s.stats(1).runs);
+}
+
+}  // namespace scheduler_tests
+
+void test_scheduler() {
+  using namespace scheduler_tests;
+  RUN_TEST(test_earliest_deadline_runs_first);
+  RUN_TEST(test_overruns_are_counted_and_releases_skipped);
+}
@@ -0,0 +1,48 @@
+#include "platform/test.h"
+// Needs to come first
+
+#include <array>
+
+#include "dsp/SoftClip.h"
+
+using zlkm::dsp::SoftClip;
+
+namespace soft_clip_tests {
+
+// Ramp through both knees, past the threshold on either side
+static float probe(int i) { return -1.6f + 0.1f * float(i); }
+
+void test_gained_block_matches_process() {
+  std::array<float, 32> in{}, gain{}, out{};
+  for (int i = 0; i < 32; ++i) {
+    in[i] = probe(i);
+    gain[i] = 0.5f + 0.05f * float(i);
+  }
+  const int clips = SoftClip::processBlock(in, gain, out);
+  int ref = 0;
+  for (int i = 0; i < 32; ++i) {
+    TEST_ASSERT_EQUAL_FLOAT(SoftClip::process(in[i] * gain[i], ref), out[i]);
+  }
+  TEST_ASSERT_EQUAL(ref, clips);
+  TEST_ASSERT_TRUE(clips > 0);
+}
+
+void test_plain_block_matches_process_in_place() {
+  std::array<float, 32> buf{};
+  for (int i = 0; i < 32; ++i) buf[i] = probe(i);
+  const int clips = SoftClip::processBlock(buf, buf);
+  int ref = 0;
+  for (int i = 0; i < 32; ++i) {
+    TEST_ASSERT_EQUAL_FLOAT(SoftClip::process(probe(i), ref), buf[i]);
+  }
+  TEST_ASSERT_EQUAL(ref, clips);
+  TEST_ASSERT_TRUE(clips > 0);
+}
+
+}  // namespace soft_clip_tests
+
+void test_soft_clip() {
+  using namespace soft_clip_tests;
+  RUN_TEST(test_gained_block_matches_process);
+  RUN_TEST(test_plain_block_matches_process_in_place);
+}
@@ -0,0 +1,87 @@
+#include "platform/test.h"
+// Needs to come first
+
+#include <array>
+
+#include "audio/engine/Swarm.h"
+
+using namespace zlkm::audio::engine;
+
+namespace swarm_tests {
+
+static constexpr int N = 7;
+static constexpr int FRAMES = 64;
+using Swarm = SwarmMorph<N, 48000>;
+
+struct Block {
+  std::array<float, FRAMES> cps, env, morph, l, r;
+  Block() {
+    cps.fill(0.004f);
+    env.fill(0.5f);
+    morph.fill(0.f);
+  }
+  void run(Swarm& s, const Swarm::Cfg& target, bool changed = true) {
+    s.processBlock(cps, env, morph, l, r, target, changed);
+  }
+};
+
+static Swarm::Cfg makeCfg(int voices) {
+  Swarm::Cfg c;
+  c.voices = voices;
+  c.morphMode = 0;
+  c.randomPhase = false;
+  return c;
+}
+
+void test_voice_count_follows_target() {
+  Swarm a(makeCfg(7)), b(makeCfg(3));
+  a.reset();
+  b.reset();
+  Block ba, bb;
+  const auto target = makeCfg(3);
+  ba.run(a, target);
+  bb.run(b, target);
+  TEST_ASSERT_EQUAL(3, a.cfg().voices);
+  for (int f = 0; f < FRAMES; ++f) {
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, bb.l[f], ba.l[f]);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, bb.r[f], ba.r[f]);
+  }
+}
+
+void test_voice_count_is_clamped() {
+  Swarm s(makeCfg(0));
+  TEST_ASSERT_EQUAL(1, s.cfg().voices);
+  Block blk;
+  blk.run(s, makeCfg(N + 5));
+  TEST_ASSERT_EQUAL(N, s.cfg().voices);
+}
+
+// After one ramp block the params sit exactly on the target, so a held
+// block renders the same as another (zero-step) ramp block
+void test_held_block_matches_settled_ramp() {
+  auto target = makeCfg(5);
+  target.morph = 0.7f;
+  target.pulseWidth = 0.3f;
+  Swarm a(makeCfg(5)), b(makeCfg(5));
+  a.reset();
+  b.reset();
+  Block ba, bb;
+  ba.run(a, target);
+  bb.run(b, target);
+  TEST_ASSERT_EQUAL_FLOAT(0.7f, a.cfg().morph);
+  ba.run(a, target, false);
+  bb.run(b, target, true);
+  for (int f = 0; f < FRAMES; ++f) {
+    TEST_ASSERT_EQUAL_FLOAT(bb.l[f], ba.l[f]);
+    TEST_ASSERT_EQUAL_FLOAT(bb.r[f], ba.r[f]);
+  }
+}
+
+}  // namespace swarm_tests
+
+void test_swarm() {
+  using namespace swarm_tests;
+  RUN_TEST(test_voice_count_follows_target);
+  RUN_TEST(test_voice_count_is_clamped);
+  RUN_TEST(test_held_block_matches_settled_ramp);
+}
@@ -0,0 +1,49 @@
+#include "platform/test.h"
+#include "util/TripleBuffer.h"
+
+using zlkm::util::TripleBuffer;
+
+namespace triple_buffer_tests {
+
+void test_update_only_after_publish() {
+  TripleBuffer<int> tb;
+  TEST_ASSERT_FALSE(tb.update());
+  TEST_ASSERT_EQUAL(0, tb.front());
+
+  tb.back() = 7;
+  TEST_ASSERT_EQUAL(0, tb.front());  // not visible before publish
+  tb.publish();
+  TEST_ASSERT_TRUE(tb.update());
+  TEST_ASSERT_EQUAL(7, tb.front());
+  TEST_ASSERT_FALSE(tb.update());  // consumed; front stays put
+  TEST_ASSERT_EQUAL(7, tb.front());
+}
+
+void test_reader_gets_newest_and_front_is_stable() {
+  TripleBuffer<int> tb;
+  for (int v = 1; v <= 5; ++v) {
+    tb.back() = v;
+    tb.publish();
+  }
+  TEST_ASSERT_TRUE(tb.update());
+  TEST_ASSERT_EQUAL(5, tb.front());
+
+  // Writer keeps going; the slot the reader holds is never handed out
+  const int* held = &tb.front();
+  for (int v = 6; v <= 20; ++v) {
+    TEST_ASSERT_TRUE(&tb.back() != held);
+    tb.back() = v;
+    tb.publish();
+  }
+  TEST_ASSERT_EQUAL(5, *held);
+  TEST_ASSERT_TRUE(tb.update());
+  TEST_ASSERT_EQUAL(20, tb.front());
+}
+
+}  // namespace triple_buffer_tests
+
+void test_triple_buffer() {
+  using namespace triple_buffer_tests;
+  RUN_TEST(test_update_only_after_publish);
+  RUN_TEST(test_reader_gets_newest_and_front_is_stable);
+}